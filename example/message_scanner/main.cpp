@@ -0,0 +1,27 @@
+#include <iostream>
+#include <string>
+#include <chrono>
+
+#include <grib_coder/grib_scanner.h>
+
+int main() {
+    const std::string grib_file_path{"./dist/data/gmf.gra.2019080700003.grb2"};
+
+    auto f = std::fopen(grib_file_path.c_str(), "rb");
+
+    const auto start_time = std::chrono::system_clock::now();
+    grib_coder::GribScanner scanner(f);
+    const auto locations = scanner.scan();
+
+    for (const auto& location : locations) {
+        std::cout << location.offset << " | " << location.length << " | " << location.discipline << std::endl;
+    }
+
+    const auto end_time = std::chrono::system_clock::now();
+    const std::chrono::duration<double> duration = end_time - start_time;
+    std::cout << locations.size() << " messages in " << duration.count() << "s" << std::endl;
+
+    std::fclose(f);
+
+    return 0;
+}
@@ -3,7 +3,7 @@
 #include <string>
 #include <chrono>
 
-#include <grib_coder/grib_file_handler.h>
+#include <grib_coder/grib_pipeline_file_handler.h>
 
 int main() {
     const std::string grib_file_path{"./dist/data/gmf.gra.2019080700003.grb2"};
@@ -11,10 +11,12 @@ int main() {
     auto f = std::fopen(grib_file_path.c_str(), "rb");
 
     const auto start_time = std::chrono::system_clock::now();
-    grib_coder::GribFileHandler handler(f);
+
+    // next messages are read and decoded in background threads.
+    auto handler = std::make_unique<grib_coder::GribPipelineFileHandler>(f);
     auto index = 1;
     std::cout << "Parsing message " << index << "..." << std::endl;
-    auto message_handler = handler.next();
+    auto message_handler = handler->next();
 
     while (message_handler) {
         const auto category = message_handler->getString("parameterCategory");
@@ -27,13 +29,14 @@ int main() {
 
         index++;
         std::cout << "Parsing message " << index << "..." << std::endl;
-        message_handler = handler.next();
+        message_handler = handler->next();
     }
 
     const auto end_time = std::chrono::system_clock::now();
     const std::chrono::duration<double> duration = end_time - start_time;
     std::cout << duration.count() << std::endl;
 
+    handler.reset();
     std::fclose(f);
 
     return 0;
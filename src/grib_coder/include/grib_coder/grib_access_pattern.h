@@ -0,0 +1,19 @@
+#pragma once
+
+namespace grib_coder {
+
+// how messages of a file will be read, used as a hint for kernel readahead and page cache.
+enum class GribAccessPattern {
+    // use default readahead of the system.
+    Normal,
+
+    // read messages in file order, such as listing a file.
+    // next messages are prefetched and pages behind current message are dropped from page cache.
+    Sequential,
+
+    // read a few selected messages, such as finding messages using index.
+    // readahead is disabled and only ranges of selected messages are prefetched.
+    Random,
+};
+
+} // namespace grib_coder
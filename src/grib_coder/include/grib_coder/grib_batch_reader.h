@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace grib_coder {
+
+class GribMessageHandler;
+class GribTableDatabase;
+
+// bytes in [offset, offset + length) of a file, such as a message found in index.
+struct GribReadRequest {
+    std::string file_path;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+
+    // count of message in file, set to message parsed by readMessages() if it is not 0.
+    uint64_t count = 0;
+};
+
+// read many scattered byte ranges at the same time.
+//
+// Reads are submitted together through io_uring on Linux, so storage is kept busy instead of
+// waiting for each read in turn. If io_uring is not available, a pool of threads reads ranges
+// with pread. Completed buffers are passed to callback in the calling thread in completion order,
+// not in request order.
+class GribBatchReader {
+public:
+    // callback of a completed read, with index of request and bytes read.
+    using ReadCallback = std::function<void(size_t, std::vector<std::byte>&&)>;
+
+    // callback of a parsed message, with index of request and message handler.
+    using MessageCallback = std::function<void(size_t, std::unique_ptr<GribMessageHandler>&&)>;
+
+    // queue_depth is max count of reads submitted at the same time.
+    // thread_count is used by thread pool, 0 means using std::thread::hardware_concurrency().
+    explicit GribBatchReader(size_t queue_depth = 64, size_t thread_count = 0);
+    ~GribBatchReader();
+
+    GribBatchReader(const GribBatchReader&) = delete;
+    GribBatchReader& operator= (const GribBatchReader&) = delete;
+
+    // read all requests, return false if any read fails. Reads not completed are still finished
+    // before returning, but their bytes are not passed to callback after a failure.
+    bool read(const std::vector<GribReadRequest>& requests, const ReadCallback& callback);
+
+    // read all requests and parse each as a grib message as soon as its bytes arrive.
+    // throw runtime_error if a message can't be parsed.
+    bool readMessages(const std::vector<GribReadRequest>& requests, const MessageCallback& callback,
+                      bool header_only = false);
+
+    // whether reads are submitted through io_uring.
+    bool isUsingIoUring() const;
+
+private:
+    bool readWithThreadPool(const std::vector<GribReadRequest>& requests, const ReadCallback& callback);
+
+    size_t queue_depth_ = 64;
+    size_t thread_count_ = 1;
+
+    std::shared_ptr<GribTableDatabase> table_database_;
+
+    // io_uring instance, nullptr if io_uring is not available.
+    struct IoUring;
+    std::unique_ptr<IoUring> io_uring_;
+};
+
+} // namespace grib_coder
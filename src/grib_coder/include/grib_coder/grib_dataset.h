@@ -0,0 +1,86 @@
+#pragma once
+
+#include <grib_coder/grib_index.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace grib_coder {
+
+class GribBatchReader;
+class GribFileHandler;
+class GribMessageHandler;
+
+// location of a message in dataset.
+struct GribDatasetRecord {
+    // index of file in GribDataset::files().
+    size_t file_index = 0;
+    GribIndexRecord record;
+};
+
+// grib2 files of one forecast run, such as gmf.gra.YYYYMMDDHHFFF.grb2 files in a directory.
+//
+// Index of each file is loaded from "<file>.idx" if it matches file size, or built by parsing
+// header sections. Records of all files are merged in the order of files, which are sorted by name.
+// Files are opened when messages are first requested from them, and one file handler is kept for
+// each file. Dataset is not thread safe.
+class GribDataset {
+public:
+    // path is a directory or a file path whose name contains wildcards '*' and '?'.
+    // in a directory, files with extension .grb2, .grib2, .grb or .grib are used.
+    explicit GribDataset(const std::string& path, bool header_only = false);
+    ~GribDataset();
+
+    GribDataset(const GribDataset&) = delete;
+    GribDataset& operator= (const GribDataset&) = delete;
+
+    const std::vector<std::string>& files() const {
+        return files_;
+    }
+
+    // load or build index for all files. It is called by queries if index is not loaded.
+    // if save_index is true, built index is written into "<file>.idx".
+    void loadIndex(bool save_index = false);
+
+    // all records in dataset.
+    const std::vector<GribDatasetRecord>& records();
+
+    // find records matching all conditions (key, value), sorted by file and offset.
+    std::vector<GribDatasetRecord> findRecords(
+        const std::vector<std::tuple<std::string, std::string>>& conditions);
+
+    // parse message of a record, return nullptr if it fails.
+    std::unique_ptr<GribMessageHandler> getMessage(const GribDatasetRecord& record);
+
+    // parse messages matching all conditions (key, value), which are read together by GribBatchReader.
+    std::vector<std::unique_ptr<GribMessageHandler>> findMessages(
+        const std::vector<std::tuple<std::string, std::string>>& conditions);
+
+private:
+    struct DatasetFile {
+        std::string path;
+        std::shared_ptr<GribIndex> index;
+        std::FILE* file = nullptr;
+        std::unique_ptr<GribFileHandler> handler;
+    };
+
+    // open file on first use.
+    GribFileHandler* getFileHandler(size_t file_index);
+
+    bool header_only_ = false;
+
+    std::vector<std::string> files_;
+    std::vector<DatasetFile> dataset_files_;
+
+    // reader of findMessages(), created on first use and reused with its table database.
+    std::unique_ptr<GribBatchReader> batch_reader_;
+
+    // merged records of all files.
+    std::vector<GribDatasetRecord> records_;
+    bool index_loaded_ = false;
+};
+
+} // namespace grib_coder
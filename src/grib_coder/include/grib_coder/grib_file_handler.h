@@ -1,12 +1,27 @@
 #pragma once
 #include <grib_coder/grib_message_handler.h>
+#include <grib_coder/grib_scanner.h>
+#include <grib_coder/grib_access_pattern.h>
+
+#include <tuple>
 
 namespace grib_coder {
 class GribTableDatabase;
+class GribMappedFile;
+class GribIndex;
 
 class GribFileHandler {
 public:
     explicit GribFileHandler(std::FILE* file, bool header_only = false);
+
+    // read messages from a memory mapped file.
+    // sections and data values keep views into the mapping instead of copying bytes.
+    explicit GribFileHandler(std::shared_ptr<GribMappedFile> mapped_file, bool header_only = false);
+
+    // use index of file to find messages by keys, which needs only one seek and one parse for each message.
+    // throw runtime_error if file size in index doesn't match file.
+    GribFileHandler(std::FILE* file, std::shared_ptr<GribIndex> index, bool header_only = false);
+
     ~GribFileHandler() = default;
 
     GribFileHandler(GribFileHandler&& handler) = default;
@@ -15,10 +30,57 @@ public:
     GribFileHandler(const GribFileHandler & handler) = delete;
     GribFileHandler& operator= (GribFileHandler) = delete;
 
+    // set hint of how messages will be read, which is passed to kernel by posix_fadvise or madvise.
+    //  - Sequential: next() prefetches bytes after current message and drops pages before it.
+    //  - Random: findMessages() prefetches only ranges of found messages.
+    // In header only mode, Sequential only drops pages, and keeps default readahead of kernel.
+    void setAccessPattern(GribAccessPattern pattern);
+
     // parse the next grib message, return nullptr if no message is available.
     std::unique_ptr<GribMessageHandler> next();
 
+    // parse the next grib message into a handler returned by previous call, whose sections are reused
+    // if layouts of messages are the same. A new handler is created if message_handler is nullptr.
+    //
+    //      auto message_handler = handler.next();
+    //      while (message_handler) {
+    //          ...
+    //          message_handler = handler.next(std::move(message_handler));
+    //      }
+    std::unique_ptr<GribMessageHandler> next(std::unique_ptr<GribMessageHandler> message_handler);
+
+    // parse messages matching all conditions (key, value) using index.
+    // current pos of file will be changed.
+    std::vector<std::unique_ptr<GribMessageHandler>> findMessages(
+        const std::vector<std::tuple<std::string, std::string>>& conditions);
+
+    // random access
+
+    // parse message by ordinal starting from 0, return nullptr if index is out of range.
+    // offset table of all messages is built on first use, using index if available.
+    // next() continues from the message after it.
+    std::unique_ptr<GribMessageHandler> messageAt(size_t index);
+
+    // parse message starting at offset, return nullptr if no message starts at offset.
+    std::unique_ptr<GribMessageHandler> messageAtOffset(uint64_t offset);
+
+    // message count in file, which also builds offset table.
+    size_t getMessageCount();
+
 private:
+    // parse message at offset and set its count.
+    std::unique_ptr<GribMessageHandler> parseMessageAt(uint64_t offset, uint64_t count);
+
+    // build offset table of all messages if it is not built.
+    void loadMessageLocations();
+
+    // hints for bytes in [offset, offset + length) of file.
+    void willNeed(uint64_t offset, uint64_t length);
+    void dontNeed(uint64_t offset, uint64_t length);
+
+    // apply hints of sequential access after message in [offset, offset + length) is parsed by next().
+    void adviseSequentialAccess(uint64_t offset, uint64_t length);
+
     // if true, data values in section 7 will not be decoded.
     bool header_only_ = false;
 
@@ -28,7 +90,28 @@ private:
     // handler of an opened grib file for reading, users should open and close it themselves.
     std::FILE* file_ = nullptr;
 
+    // memory mapped file, used instead of file_ if set.
+    std::shared_ptr<GribMappedFile> mapped_file_;
+
+    // offset of next message in mapped_file_.
+    uint64_t position_ = 0;
+
+    // message index of file, used by findMessages().
+    std::shared_ptr<GribIndex> index_;
+
     // current grib message count, used for message handler
     uint64_t count_ = 0;
+
+    GribAccessPattern access_pattern_ = GribAccessPattern::Normal;
+
+    // pages before this offset are dropped in sequential access.
+    uint64_t dropped_position_ = 0;
+
+    // bytes before this offset are prefetched in sequential access.
+    uint64_t prefetched_position_ = 0;
+
+    // offset table of all messages, built by loadMessageLocations().
+    std::vector<GribMessageLocation> message_locations_;
+    bool message_locations_loaded_ = false;
 };
 } // namespace grib_coder
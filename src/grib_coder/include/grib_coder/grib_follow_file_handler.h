@@ -0,0 +1,65 @@
+#pragma once
+
+#include <grib_coder/grib_message_handler.h>
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace grib_coder {
+
+// read messages of a grib2 file which is still being written, like tail -f.
+//
+// next() returns a message only when all its bytes including trailing "7777" are in file. If the next
+// message is not complete, it waits for file to grow, using inotify on Linux and polling on other systems,
+// and continues from offset after the last complete message.
+class GribFollowFileHandler {
+public:
+    // idle_timeout is max time to wait for the next message, zero means waiting forever.
+    // throw runtime_error if file can't be opened.
+    explicit GribFollowFileHandler(
+        const std::string& file_path,
+        bool header_only = false,
+        std::chrono::milliseconds idle_timeout = std::chrono::milliseconds{0});
+    ~GribFollowFileHandler();
+
+    GribFollowFileHandler(const GribFollowFileHandler&) = delete;
+    GribFollowFileHandler& operator= (const GribFollowFileHandler&) = delete;
+
+    // wait for next complete message and parse it, reusing message_handler if it is set.
+    // return nullptr if waiting times out, or bytes at next offset are not a grib2 message.
+    std::unique_ptr<GribMessageHandler> next(std::unique_ptr<GribMessageHandler> message_handler = nullptr);
+
+    // offset after the last complete message.
+    uint64_t getCompletedOffset() const {
+        return completed_offset_;
+    }
+
+private:
+    enum class MessageState {
+        Complete,
+        Incomplete,
+        Invalid,
+    };
+
+    // check whether message at completed_offset_ is in file, and get its length.
+    MessageState checkNextMessage(uint64_t& total_length);
+
+    // wait until file may be changed or timeout.
+    void waitForChange(std::chrono::milliseconds timeout);
+
+    std::string file_path_;
+    bool header_only_ = false;
+    std::chrono::milliseconds idle_timeout_{0};
+    std::shared_ptr<GribTableDatabase> table_database_;
+
+    std::FILE* file_ = nullptr;
+
+    uint64_t completed_offset_ = 0;
+    uint64_t count_ = 0;
+
+    // inotify instance watching file, -1 if polling is used.
+    int inotify_fd_ = -1;
+};
+
+} // namespace grib_coder
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace grib_coder {
+
+class GribMessageHandler;
+
+// offset, length and a fixed set of keys of one message.
+struct GribIndexRecord {
+    // message count in file, starting from 1.
+    uint64_t count = 0;
+    uint64_t offset = 0;
+    uint64_t length = 0;
+
+    long discipline = 0;
+    long parameter_category = 0;
+    long parameter_number = 0;
+    std::string type_of_level;
+    std::string level;
+    std::string step_range;
+    long data_date = 0;
+    long data_time = 0;
+    std::string grid_type;
+    std::string packing_type;
+
+    // get value of key as string. code table keys return code values instead of table abbreviations.
+    std::string getString(const std::string& key) const;
+
+    // get value of number key, such as code table keys and dataDate.
+    long getLong(const std::string& key) const;
+};
+
+// whether key is a code table key stored as code number in index. getString of a message returns
+// abbreviation in code table for it, so conditions of these keys are compared with code numbers.
+bool is_code_number_key(const std::string& key);
+
+// whether value of key in item equals value of all conditions (key, value).
+// item is a GribIndexRecord or a GribMessageHandler, so records and parsed messages are matched in the same way.
+template <typename T>
+bool match_conditions(T& item, const std::vector<std::tuple<std::string, std::string>>& conditions) {
+    for (const auto& condition : conditions) {
+        const auto& key = std::get<0>(condition);
+        const auto value = is_code_number_key(key) ? std::to_string(item.getLong(key)) : item.getString(key);
+        if (value != std::get<1>(condition)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// message index of a grib file, which can be saved into a compact binary file (.idx).
+//
+// index file layout (big endian):
+//  - header: "GIDX", version (2), grib file size (8), record count (8)
+//  - string table: string count (4), and for each string: length (2), chars
+//  - records: offset (8), length (8), discipline (1), parameterCategory (1), parameterNumber (1),
+//      dataDate (4), dataTime (2), and string ids (4) of typeOfLevel, level, stepRange,
+//      gridType and packingType.
+class GribIndex {
+public:
+    // keys stored in index.
+    static const std::vector<std::string>& keys();
+
+    // add keys of a parsed message. header only messages are enough.
+    void addMessage(GribMessageHandler* message_handler);
+
+    const std::vector<GribIndexRecord>& records() const {
+        return records_;
+    }
+
+    // find records matching all conditions (key, value).
+    std::vector<GribIndexRecord> findRecords(
+        const std::vector<std::tuple<std::string, std::string>>& conditions) const;
+
+    // size of the indexed grib file, used to check whether index is out of date.
+    uint64_t getFileSize() const {
+        return file_size_;
+    }
+
+    void setFileSize(uint64_t file_size) {
+        file_size_ = file_size;
+    }
+
+    // build index by parsing header sections of all messages in grib file, and record its size.
+    // return false if file can't be opened.
+    bool buildFromFile(const std::string& file_path);
+
+    bool readFile(const std::string& index_file_path);
+    bool writeFile(const std::string& index_file_path) const;
+
+private:
+    std::vector<GribIndexRecord> records_;
+    uint64_t file_size_ = 0;
+};
+
+} // namespace grib_coder
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace grib_coder {
+
+// compact id of a property key.
+//
+// Key names are interned in a global registry, and the same name always gets the same id.
+// Create ids once outside hot loops, and use them with overloads such as GribMessageHandler::getLong(KeyId),
+// which find properties by index without hashing or comparing strings.
+//
+//      static const KeyId level_key{"level"};
+//      message_handler->getString(level_key);
+class KeyId {
+public:
+    KeyId() = default;
+
+    // intern key name, which is thread safe.
+    explicit KeyId(const std::string& name);
+
+    uint32_t getIndex() const {
+        return index_;
+    }
+
+    const std::string& getName() const {
+        return *name_;
+    }
+
+    // std::hash of name, computed once when name is interned.
+    size_t getHash() const {
+        return hash_;
+    }
+
+    bool isValid() const {
+        return index_ != invalid_index;
+    }
+
+    bool operator== (const KeyId& other) const {
+        return index_ == other.index_;
+    }
+
+    bool operator!= (const KeyId& other) const {
+        return index_ != other.index_;
+    }
+
+private:
+    static const uint32_t invalid_index = UINT32_MAX;
+
+    uint32_t index_ = invalid_index;
+
+    // name interned in registry, which is never released.
+    const std::string* name_ = &empty_name;
+    size_t hash_ = 0;
+
+    static const std::string empty_name;
+};
+
+} // namespace grib_coder
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <grib_coder/grib_access_pattern.h>
+
+#include <gsl/span>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace grib_coder {
+
+// read-only memory mapping of a whole grib file.
+// messages parsed from the mapping keep views into it, so share it using std::shared_ptr.
+class GribMappedFile {
+public:
+    explicit GribMappedFile(const std::string& file_path);
+    ~GribMappedFile();
+
+    GribMappedFile(const GribMappedFile&) = delete;
+    GribMappedFile& operator= (const GribMappedFile&) = delete;
+
+    const std::byte* data() const {
+        return data_;
+    }
+
+    uint64_t size() const {
+        return size_;
+    }
+
+    // bytes in [offset, offset + length), clipped at the end of file.
+    gsl::span<const std::byte> bytes(uint64_t offset, uint64_t length) const;
+
+    // hints for kernel, which are ignored if not supported by the system.
+
+    void setAccessPattern(GribAccessPattern pattern) const;
+
+    // prefetch bytes in [offset, offset + length).
+    void willNeed(uint64_t offset, uint64_t length) const;
+
+    // drop bytes in [offset, offset + length) from memory and page cache.
+    // views into these bytes are still valid, and bytes will be read again when they are used.
+    void dontNeed(uint64_t offset, uint64_t length) const;
+
+private:
+    const std::byte* data_ = nullptr;
+    uint64_t size_ = 0;
+
+#ifdef _WIN32
+    // no mmap on Windows, read the whole file instead.
+    std::vector<std::byte> buffer_;
+#else
+    // page aligned range [begin, begin + length) covering bytes [offset, offset + length) in file.
+    std::tuple<uint64_t, uint64_t> pageRange(uint64_t offset, uint64_t length) const;
+
+    int fd_ = -1;
+#endif
+};
+
+} // namespace grib_coder
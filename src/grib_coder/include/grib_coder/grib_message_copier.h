@@ -0,0 +1,56 @@
+#pragma once
+
+#include <grib_coder/grib_scanner.h>
+
+#include <cstdio>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace grib_coder {
+
+// copy grib2 messages byte for byte from one file to another. Messages are never decoded or encoded.
+//
+// On Linux bytes are copied by copy_file_range, or sendfile if file systems don't support it,
+// so they are not copied through user space.
+class GribMessageCopier {
+public:
+    // target file is created or truncated. throw runtime_error if files can't be opened,
+    // or target is the same file as source.
+    GribMessageCopier(const std::string& source_path, const std::string& target_path);
+    ~GribMessageCopier();
+
+    GribMessageCopier(const GribMessageCopier&) = delete;
+    GribMessageCopier& operator= (const GribMessageCopier&) = delete;
+
+    // append bytes [offset, offset + length) of source file to target file.
+    bool copyMessage(uint64_t offset, uint64_t length);
+
+    bool copyMessages(const std::vector<GribMessageLocation>& locations);
+
+    // copy messages matching all conditions (key, value), return count of copied messages.
+    // only header sections are parsed to check conditions.
+    size_t copyMatchingMessages(const std::vector<std::tuple<std::string, std::string>>& conditions);
+
+    // bytes written into target file.
+    uint64_t getCopiedLength() const {
+        return copied_length_;
+    }
+
+private:
+    // copy bytes through a buffer when system calls above are not available.
+    bool copyBuffered(uint64_t offset, uint64_t length);
+
+    std::string source_path_;
+    uint64_t copied_length_ = 0;
+
+#ifdef _WIN32
+    std::FILE* source_file_ = nullptr;
+    std::FILE* target_file_ = nullptr;
+#else
+    int source_fd_ = -1;
+    int target_fd_ = -1;
+#endif
+};
+
+} // namespace grib_coder
@@ -1,14 +1,21 @@
 #pragma once
 
+#include <grib_coder/grib_key.h>
+#include <grib_coder/grib_property_table.h>
 #include <grib_property/grib_property_container.h>
 #include <grib_property/number_property.h>
 
+#include <gsl/span>
+
+#include <tuple>
 #include <unordered_map>
 
 
 namespace grib_coder {
 class GribTableDatabase;
 class GribSection;
+class GribMappedFile;
+class DataValuesProperty;
 
 class GribMessageHandler final: public GribPropertyContainer {
 public:
@@ -23,13 +30,52 @@ public:
 
     // parse, dump and pack
 
+    // Handler can be parsed again for another message. Sections of previous message are reused
+    // when their layouts match, so parsing many messages with one handler avoids most allocations.
+
     // parse current grib message from file.
-    // current pos of file will be changed.
+    // the whole message is read at once, or only sections before section 7 in header only mode.
+    // current pos of file will be changed to the end of message.
     bool parseFile(std::FILE* file);
 
-    // decode values in section 7 regardless of handler_only flag.
+    // parse grib message from bytes which begin with section 0.
+    // bytes are copied into the handler, so they can be released after parsing.
+    bool parseBuffer(const std::byte* data, size_t length);
+
+    // parse grib message from bytes which begin with section 0, and take ownership of bytes.
+    bool parseBuffer(std::vector<std::byte>&& buffer);
+
+    // parse grib message at offset of a memory mapped file.
+    // sections keep views into the mapping, which is kept alive by the handler.
+    bool parseMappedFile(const std::shared_ptr<GribMappedFile>& mapped_file, uint64_t offset);
+
+    // decode values in section 6 and section 7 regardless of handler_only flag.
     bool decodeValues();
 
+    // decode values of section 7 directly into buffer of caller, without keeping them in handler,
+    // such as one buffer reused for all messages read in header only mode. Values are scaled in double
+    // and converted when they are stored, so float buffers get the same values as getValues().
+    // size of buffer should be equal to count of values as in getValues(), return false if it doesn't match
+    // or decoding fails.
+    bool decodeValues(gsl::span<double> values);
+    bool decodeValues(gsl::span<float> values);
+
+    // data values decoded when parsing, or by decodeValues() in header only mode.
+
+    // copy values into buffer of caller, such as one buffer reused for all messages.
+    // size of buffer should be equal to count of values, which is size of getValuesView().
+    // return false if values are not decoded or size doesn't match.
+    bool getValues(gsl::span<double> values);
+    bool getValues(gsl::span<float> values);
+
+    // values without copying, valid until another message is parsed or values are decoded again.
+    gsl::span<const double> getValuesView();
+
+    // drop bytes of data values held by section 7 after values are decoded, such as values read
+    // in header only mode, to keep only decoded values of many messages.
+    // bytes of whole message read by parseFile are kept. message can't be packed until values are encoded again.
+    void releaseRawValues();
+
     // dump grib message into stdout.
     void dump(const DumpConfig& dump_config = DumpConfig{});
 
@@ -51,14 +97,32 @@ public:
     void setString(const std::string& key, const std::string& value) override;
     std::string getString(const std::string& key) override;
 
-    // NOTE: need to optimization
     bool hasProperty(const std::string& key) override;
 
+    void setDoubleArray(const std::string& key, std::vector<double>& values) override;
+    std::vector<double> getDoubleArray(const std::string& key) override;
+
     template <typename T>
     T get(const std::string& key);
 
+    // after a message is parsed, property is found in a flat table of all properties with one probe.
     GribProperty* getProperty(const std::string& name);
 
+    // properties by key id, which is resolved by name only once for each message.
+
+    void setLong(KeyId key, long value);
+    long getLong(KeyId key);
+
+    void setDouble(KeyId key, double value);
+    double getDouble(KeyId key);
+
+    void setString(KeyId key, const std::string& value);
+    std::string getString(KeyId key);
+
+    bool hasProperty(KeyId key);
+
+    GribProperty* getProperty(KeyId key);
+
     auto getTableDatabase() const {
         return table_database_;
     }
@@ -76,17 +140,62 @@ public:
     }
 
 private:
-    // parse next section 1 - 7. currently section 2 is not supported.
-    bool parseNextSection(std::FILE* file);
+    template <typename T>
+    bool decodeValuesInto(gsl::span<T> values);
+
+    // parse all sections from bytes which begin with section 0.
+    bool parseBytes(gsl::span<const std::byte> bytes);
+
+    // parse sections in header only mode, data values in section 7 are not read.
+    // total_length is checked against file size by parseFile before calling it.
+    bool parseFileHeaders(std::FILE* file, uint64_t total_length);
+
+    // read bytes from file to make length of buffer at least length.
+    bool readFileBuffer(std::FILE* file, size_t length);
+
+    // parse section 1 - 7 from bytes of the whole section. currently section 2 is not supported.
+    bool parseNextSection(gsl::span<const std::byte> bytes);
+
+    // move sections of previous message into recycled_sections_.
+    void recycleSections();
+
+    // add section for the next position in section_list_, reusing recycled section at the same position if possible.
+    std::shared_ptr<GribSection> nextSection(int section_number, long section_length);
+
+    std::shared_ptr<GribSection> createSection(int section_number, long section_length);
+
+    // decode section after parsing, and decode values if header only flag is not set.
+    bool decodeSection(const std::shared_ptr<GribSection>& section);
 
     auto getSection(int section_number, size_t begin_pos = 0);
 
+    // build property_table_ after all sections are parsed, or reuse it if properties of sections are not changed.
+    void buildPropertyTable();
+
+    // property of data values in section 7, nullptr if section 7 is not parsed.
+    DataValuesProperty* getDataValuesProperty();
+
+    // set table database of code table property before accessing it.
+    void prepareCodeTableProperty(GribProperty* property);
+
     // same as header only flag in GribFileHandler.
     bool header_only_ = false;
 
     std::vector<std::shared_ptr<GribSection>> section_list_;
+
+    // sections of previous message, which may be reused by current message.
+    std::vector<std::shared_ptr<GribSection>> recycled_sections_;
     std::shared_ptr<GribTableDatabase> table_database_;
 
+    // message bytes read from file, sections hold views into it.
+    std::vector<std::byte> buffer_;
+
+    // position, length and number of sections in buffer_, used by parseFileHeaders.
+    std::vector<std::tuple<size_t, uint32_t, uint8_t>> section_headers_;
+
+    // keep memory mapped file alive while sections hold views into it.
+    std::shared_ptr<GribMappedFile> mapped_file_;
+
     // message offset in file.
     NumberProperty<uint64_t> offset_;
 
@@ -96,6 +205,21 @@ private:
     // store message only properties.
     std::unordered_map<std::string, GribProperty*> property_map_;
 
+    // all properties of handler and sections. While parsing, properties are found in sections one by one.
+    GribPropertyTable property_table_;
+    bool property_table_ready_ = false;
+
+    // property versions of sections used to build property_table_.
+    std::vector<uint64_t> property_table_versions_;
+
+    // properties of key ids resolved from property_table_, indexed by KeyId::getIndex().
+    // cleared when property_table_ is rebuilt.
+    struct ResolvedProperty {
+        GribProperty* property = nullptr;
+        bool resolved = false;
+    };
+    std::vector<ResolvedProperty> resolved_properties_;
+
     double missing_value_ = 9999;
 };
 
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <grib_coder/octet_layout.h>
+
+#include <gsl/span>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace grib_coder {
+
+// position of a key in bytes of a message.
+struct GribKeyLocation {
+    int section_number = -1;
+
+    // number of template in section 3, 4 or 5 which contains the key, -1 for fields before template.
+    long template_number = -1;
+
+    // offset from the beginning of message.
+    uint64_t offset = 0;
+    size_t length = 0;
+    OctetValueType value_type = OctetValueType::Unsigned;
+};
+
+// read header keys directly from bytes of a message, without creating sections and properties
+// as GribMessageHandler does.
+//
+// Keys are resolved to octets by fixed layouts of section 0, 1, 3, 4, 5, 6, templates 4.0, 4.1, 4.8, 4.11,
+// 5.0 and 5.40. Only keys stored in bytes can be read, so computed keys such as level or stepRange are not
+// available, and code table keys are read as numbers. It is used to filter messages found by GribScanner
+// before parsing them:
+//
+//      for (const auto& location : scanner.scan()) {
+//          GribMessagePeeker peeker{mapped_file->bytes(location.offset, location.length)};
+//          if (peeker.getLong("parameterNumber") == 0) {
+//              ...
+//          }
+//      }
+class GribMessagePeeker {
+public:
+    // bytes begin with section 0, and contain sections before section 7 at least.
+    // bytes are not copied, and should be alive while peeker is used.
+    explicit GribMessagePeeker(gsl::span<const std::byte> message_bytes);
+
+    // whether bytes begin with section 0 of a grib2 message.
+    bool isValid() const {
+        return valid_;
+    }
+
+    // find key in the first section containing it.
+    // return empty if key is unknown, or template of key is not used in this message.
+    std::optional<GribKeyLocation> findKey(const std::string& key) const;
+
+    // return empty if key is not found or value type doesn't match.
+    // getDouble accepts all number keys.
+
+    std::optional<long> getLong(const std::string& key) const;
+    std::optional<double> getDouble(const std::string& key) const;
+    std::optional<std::string> getString(const std::string& key) const;
+
+private:
+    // locate sections after section 0 until section 7 or the end of bytes.
+    void findSections();
+
+    // find key in fields of section, skipping fields after template_octet if template number
+    // of section is not template_number.
+    std::optional<GribKeyLocation> findKeyInFields(
+        const std::string& key, int section_number, gsl::span<const OctetFieldInfo> fields,
+        size_t template_octet = 0, long template_number = -1) const;
+
+    // template number in 2 octets at octet of section.
+    long readTemplateNumber(int section_number, size_t octet) const;
+
+    gsl::span<const std::byte> bytes_;
+    bool valid_ = false;
+
+    // offset and length of the first section of each number, length is 0 if section is not found.
+    std::array<uint64_t, 8> section_offsets_{};
+    std::array<uint64_t, 8> section_lengths_{};
+};
+
+} // namespace grib_coder
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <grib_coder/grib_scanner.h>
+
+#include <memory>
+
+namespace grib_coder {
+
+class GribMappedFile;
+
+// find message boundaries with several threads.
+//
+// file is split into byte ranges, one for each thread. Each thread resynchronises on the first
+// "GRIB" identifier with edition number 2 in its range, and then follows totalLength to
+// collect messages. Every message is checked by totalLength and the end section "7777".
+// Results are merged by walking from the beginning of file, so the message list is the same
+// as the one given by a serial pass.
+class GribParallelScanner {
+public:
+    // thread_count = 0 means using std::thread::hardware_concurrency().
+    explicit GribParallelScanner(std::shared_ptr<GribMappedFile> mapped_file, size_t thread_count = 0);
+
+    std::vector<GribMessageLocation> scan();
+
+private:
+    // collect messages in [begin, end). The last message may end after end.
+    std::vector<GribMessageLocation> scanRange(uint64_t begin, uint64_t end) const;
+
+    // check message starting at offset using section 0 and section 8.
+    std::optional<GribMessageLocation> checkMessage(uint64_t offset) const;
+
+    // find the next "GRIB" identifier with edition number 2 in [begin, end), return end if not found.
+    uint64_t findIdentifier(uint64_t begin, uint64_t end) const;
+
+    std::shared_ptr<GribMappedFile> mapped_file_;
+    size_t thread_count_ = 1;
+};
+
+} // namespace grib_coder
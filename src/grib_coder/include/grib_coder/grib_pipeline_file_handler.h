@@ -0,0 +1,74 @@
+#pragma once
+
+#include <grib_coder/grib_message_handler.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace grib_coder {
+
+// read and decode grib2 messages in background, and return them in file order.
+//
+// A reader thread reads bytes of the next messages into a bounded queue, and a fixed pool of worker threads
+// parses and decodes them while the caller is handling earlier ones. queue_size limits prefetched messages,
+// and worker count is the smaller of queue_size and hardware concurrency.
+class GribPipelineFileHandler {
+public:
+    // decide whether data values of a message should be decoded, using properties from header sections.
+    // filter is called in decoding threads.
+    using DecodeFilter = std::function<bool(GribMessageHandler*)>;
+
+    // file should be kept open until the handler is destroyed.
+    // If filter is not set, data values of all messages are decoded.
+    explicit GribPipelineFileHandler(std::FILE* file, size_t queue_size = 8, DecodeFilter filter = {});
+    ~GribPipelineFileHandler();
+
+    GribPipelineFileHandler(const GribPipelineFileHandler&) = delete;
+    GribPipelineFileHandler& operator= (const GribPipelineFileHandler&) = delete;
+
+    // return next message in file order, nullptr if there is no message.
+    // errors in reader or worker threads, such as parsing failures or std::bad_alloc, are rethrown here.
+    std::unique_ptr<GribMessageHandler> next();
+
+private:
+    // read messages until file end or the handler is stopped.
+    void readMessages();
+
+    // run decoding tasks until the handler is stopped.
+    void runTasks();
+
+    // parse message bytes and decode values if filter accepts the message, throw if either fails.
+    std::unique_ptr<GribMessageHandler> decodeMessage(
+        std::vector<std::byte> bytes, uint64_t offset, uint64_t count);
+
+    std::FILE* file_ = nullptr;
+    size_t queue_size_ = 8;
+    DecodeFilter filter_;
+    std::shared_ptr<GribTableDatabase> table_database_;
+
+    // messages being decoded or waiting for next(), in file order.
+    std::deque<std::future<std::unique_ptr<GribMessageHandler>>> queue_;
+    std::mutex mutex_;
+    std::condition_variable queue_not_full_;
+    std::condition_variable queue_not_empty_;
+
+    // decoding tasks of messages in queue_, not started yet.
+    std::deque<std::packaged_task<std::unique_ptr<GribMessageHandler>()>> tasks_;
+    std::condition_variable tasks_not_empty_;
+
+    // set by reader thread when no more messages will be added.
+    bool finished_ = false;
+
+    // set by destructor to stop reader thread.
+    bool stopped_ = false;
+
+    std::thread reader_;
+    std::vector<std::thread> workers_;
+};
+
+} // namespace grib_coder
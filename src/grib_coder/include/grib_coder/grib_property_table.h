@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace grib_coder {
+
+class GribProperty;
+
+// flat open addressing hash table from key name to property, built once after a message is parsed.
+//
+// Names are not copied, and should live as long as the table, such as keys of property maps in sections.
+class GribPropertyTable {
+public:
+    GribPropertyTable() = default;
+
+    // remove all properties and keep memory of slots.
+    void clear();
+
+    // add property with name. If name is already added, the first property is kept.
+    void add(const std::string& name, GribProperty* property) {
+        add(name, std::hash<std::string>{}(name), property);
+    }
+
+    // add with hash of name computed before.
+    void add(const std::string& name, size_t hash, GribProperty* property);
+
+    // return nullptr if name is not found.
+    GribProperty* find(const std::string& name) const {
+        return find(name, std::hash<std::string>{}(name));
+    }
+
+    // find with hash of name computed before, such as KeyId::getHash().
+    GribProperty* find(const std::string& name, size_t hash) const;
+
+    size_t size() const {
+        return size_;
+    }
+
+private:
+    struct Slot {
+        size_t hash = 0;
+        const std::string* name = nullptr;
+        GribProperty* property = nullptr;
+    };
+
+    void grow();
+
+    // count of slots is a power of two and at least twice the count of properties, so probing is short.
+    std::vector<Slot> slots_;
+    size_t size_ = 0;
+};
+
+} // namespace grib_coder
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <vector>
+
+namespace grib_coder {
+
+// location of a grib message in file.
+struct GribMessageLocation {
+    uint64_t offset = 0;
+    uint64_t length = 0;
+    int discipline = 0;
+};
+
+// find message boundaries using only section 0, without parsing any other sections.
+class GribScanner {
+public:
+    // handler of an opened grib file for reading, users should open and close it themselves.
+    explicit GribScanner(std::FILE* file);
+
+    // find the next message from current pos of file, return empty if no complete message is available.
+    // file pos is moved to the end of the message.
+    std::optional<GribMessageLocation> next();
+
+    // find all messages from current pos of file.
+    std::vector<GribMessageLocation> scan();
+
+private:
+    std::FILE* file_ = nullptr;
+
+    // file size when scanner is created, used to skip the incomplete last message.
+    uint64_t file_size_ = 0;
+};
+
+} // namespace grib_coder
@@ -3,6 +3,9 @@
 #include <grib_property/number_property.h>
 #include <grib_property/grib_component.h>
 
+#include <gsl/span>
+
+#include <tuple>
 #include <vector>
 #include <unordered_map>
 #include <cstdio>
@@ -10,6 +13,7 @@
 namespace grib_coder {
 
 class GribMessageHandler;
+class GribPropertyTable;
 
 class GribSection : public GribComponent {
 public:
@@ -43,6 +47,16 @@ public:
     void registerProperty(const std::string& name, GribProperty* property);
     void unregisterProperty(const std::string& name);
 
+    // add all registered properties into table.
+    // hashes of names are computed again only when properties are changed.
+    void addPropertiesToTable(GribPropertyTable& table);
+
+    // changed when properties are registered or unregistered, such as when template is generated again.
+    // versions are unique among all sections.
+    uint64_t getPropertyVersion() const {
+        return property_version_;
+    }
+
     // section length and number
     void setSectionLength(long length);
     long getSectionLength() const;
@@ -51,8 +65,21 @@ public:
 
     int getSectionNumber() const;
 
+    // prepare section to be parsed again for another message with section_length.
+    // return false if layout of section can't be reused, and a new section should be created.
+    // default implementation only reuses sections with the same length.
+    virtual bool resetSection(long section_length);
+
     // parse, dump and pack
-    virtual bool parseFile(std::FILE* file, bool header_only = false) = 0;
+
+    // parse section from file after section length and section number are read.
+    // default implementation reads the whole section into buffer_ and calls parseBytes().
+    virtual bool parseFile(std::FILE* file, bool header_only = false);
+
+    // parse section from bytes which begin with section length and section number.
+    // large data such as section 7 may keep a view into bytes instead of copying them,
+    // so bytes should live as long as the section.
+    virtual bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) = 0;
 
     bool decode(GribMessageHandler* handler) override;
 
@@ -73,9 +100,20 @@ protected:
     // including other properties which are not in grib file, such as computed properties.
     // template properties are also registered into section's property map.
     std::unordered_map<std::string, GribProperty*> property_map_;
+    uint64_t property_version_ = 0;
+
+    // nodes of unregistered properties, reused by registerProperty so templates can be switched without allocating.
+    std::vector<std::unordered_map<std::string, GribProperty*>::node_type> spare_property_nodes_;
+
+    // properties in property_map_ with hashes of their names, for property version in hashed_properties_version_.
+    std::vector<std::tuple<size_t, const std::string*, GribProperty*>> hashed_properties_;
+    uint64_t hashed_properties_version_ = 0;
 
     NumberProperty<uint8_t> section_number_;
     NumberProperty<uint32_t> section_length_;
+
+    // section bytes read from file. properties may keep views into it.
+    std::vector<std::byte> buffer_;
 };
 
 GribProperty* get_property_from_section_list(
@@ -22,7 +22,7 @@ public:
     }
 
     // parse, dump and pack
-    bool parse(std::vector<std::byte>::const_iterator& iterator) override;
+    bool parse(const std::byte*& iterator) override;
 
     void dumpTemplate(GribMessageHandler* message_handler, std::size_t start_octec,
                       const DumpConfig& dump_config = DumpConfig{});
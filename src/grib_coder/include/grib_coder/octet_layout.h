@@ -0,0 +1,145 @@
+#pragma once
+
+#include <grib_property/code_table_property.h>
+#include <grib_property/number_property.h>
+#include <grib_property/string_property.h>
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace grib_coder {
+
+// length of field should match type of its property.
+
+template <typename T>
+constexpr bool is_valid_field_length(const NumberProperty<T>*, size_t length) {
+    return length == sizeof(T);
+}
+
+constexpr bool is_valid_field_length(const CodeTableProperty*, size_t length) {
+    return length == 1 || length == 2;
+}
+
+constexpr bool is_valid_field_length(const StringProperty*, size_t length) {
+    return length > 0;
+}
+
+// how bytes of field are converted to value.
+enum class OctetValueType {
+    Unsigned,
+    Signed,
+    Float,
+    String,
+};
+
+template <typename T>
+constexpr OctetValueType octet_value_type(const NumberProperty<T>*) {
+    if (std::is_floating_point<T>::value) {
+        return OctetValueType::Float;
+    }
+    return std::is_signed<T>::value ? OctetValueType::Signed : OctetValueType::Unsigned;
+}
+
+constexpr OctetValueType octet_value_type(const CodeTableProperty*) {
+    return OctetValueType::Unsigned;
+}
+
+constexpr OctetValueType octet_value_type(const StringProperty*) {
+    return OctetValueType::String;
+}
+
+// field of a layout without its property, used to read values from bytes directly.
+struct OctetFieldInfo {
+    size_t octet;
+    size_t length;
+    const char* name;
+    OctetValueType value_type;
+};
+
+// a field of a fixed layout in section or template, which uses octets [octet, octet + length)
+// numbered from 1 at the beginning of section as in WMO manual, and is stored in a member property of Owner.
+//
+// A layout is a constexpr tuple of fields, such as
+//
+//      constexpr auto layout = std::make_tuple(
+//          octet_field(1, 4, "section1Length", &GribSection1::section_length_),
+//          octet_field(5, 1, "numberOfSection", &GribSection1::section_number_),
+//          ...
+//      );
+//
+// which is checked at compile time, and unpacked by big-endian loads without virtual calls.
+template <typename Owner, typename Property>
+struct OctetField {
+    size_t octet;
+    size_t length;
+    const char* name;
+    Property Owner::* property;
+
+    constexpr bool hasValidLength() const {
+        return is_valid_field_length(static_cast<const Property*>(nullptr), length);
+    }
+
+    constexpr OctetFieldInfo getInfo() const {
+        return OctetFieldInfo{octet, length, name, octet_value_type(static_cast<const Property*>(nullptr))};
+    }
+};
+
+template <typename Owner, typename Property>
+constexpr OctetField<Owner, Property> octet_field(
+    size_t octet, size_t length, const char* name, Property Owner::* property) {
+    return OctetField<Owner, Property>{octet, length, name, property};
+}
+
+// check fields cover octets [first_octet, end_octet) one after another, and lengths match properties.
+template <typename Layout>
+constexpr bool is_valid_octet_layout(const Layout& layout, size_t first_octet, size_t end_octet) {
+    auto octet = first_octet;
+    auto result = true;
+    std::apply([&](const auto&... field) {
+        ((result = result && field.octet == octet && field.hasValidLength(), octet += field.length), ...);
+    }, layout);
+    return result && octet == end_octet;
+}
+
+// infos of all fields in layout.
+template <typename Layout>
+constexpr auto octet_field_infos(const Layout& layout) {
+    return std::apply([](const auto&... field) {
+        return std::array<OctetFieldInfo, sizeof...(field)>{field.getInfo()...};
+    }, layout);
+}
+
+// load value of field from bytes without virtual calls.
+
+template <typename T>
+inline void load_octet_field(NumberProperty<T>& property, const std::byte* bytes, size_t) {
+    property.setValue(convert_bytes_to_number<T>(bytes));
+}
+
+inline void load_octet_field(CodeTableProperty& property, const std::byte* bytes, size_t length) {
+    property.setValue(length == 1 ? convert_bytes_to_number<uint8_t>(bytes) : convert_bytes_to_number<uint16_t>(bytes));
+}
+
+inline void load_octet_field(StringProperty& property, const std::byte* bytes, size_t length) {
+    property.setValue(reinterpret_cast<const char*>(bytes), length);
+}
+
+// unpack all fields of layout in one pass. section_bytes begin with octet 1 of section.
+template <typename Owner, typename Layout>
+inline void unpack_octet_fields(Owner& owner, const std::byte* section_bytes, const Layout& layout) {
+    std::apply([&](const auto&... field) {
+        (load_octet_field(owner.*(field.property), section_bytes + field.octet - 1, field.length), ...);
+    }, layout);
+}
+
+// call function(length, name, property) for each field, such as creating components and registering properties.
+template <typename Owner, typename Layout, typename Function>
+void for_each_octet_field(Owner& owner, const Layout& layout, Function function) {
+    std::apply([&](const auto&... field) {
+        (function(field.length, field.name, &(owner.*(field.property))), ...);
+    }, layout);
+}
+
+} // namespace grib_coder
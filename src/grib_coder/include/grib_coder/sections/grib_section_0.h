@@ -1,6 +1,7 @@
 #pragma once
 
 #include <grib_coder/grib_section.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/code_table_property.h>
 #include <grib_property/string_property.h>
 
@@ -12,11 +13,19 @@ public:
 
     bool parseFile(std::FILE* file, bool header_only = false) override;
 
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
+
     bool encode(GribMessageHandler* handler) override;
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed layout of all fields in section.
+    static constexpr auto octetLayout();
+
     StringProperty identifier_;
     NumberProperty<uint16_t> reserved_;
     CodeTableProperty discipline_;
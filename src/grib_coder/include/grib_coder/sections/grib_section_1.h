@@ -1,6 +1,7 @@
 #pragma once
 
 #include <grib_coder/grib_section.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/code_table_property.h>
 #include <grib_property/computed/data_date_property.h>
 #include <grib_property/computed/data_time_property.h>
@@ -11,13 +12,19 @@ public:
     GribSection1();
     explicit GribSection1(long section_length);
 
-    bool parseFile(std::FILE* file, bool header_only = false) override;
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
 
     bool decode(GribMessageHandler* container) override;
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed layout of all fields in section.
+    static constexpr auto octetLayout();
+
     NumberProperty<uint16_t> centre_;
     NumberProperty<uint16_t> sub_centre_;
     CodeTableProperty tables_version_;
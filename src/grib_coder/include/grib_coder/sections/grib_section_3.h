@@ -1,5 +1,6 @@
 #pragma once
 #include <grib_coder/grib_section.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/code_table_property.h>
 #include <grib_property/computed/grid_type_property.h>
 
@@ -9,13 +10,19 @@ public:
     GribSection3();
     explicit GribSection3(long section_length);
 
-    bool parseFile(std::FILE* file, bool header_only = false) override;
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
 
     bool decode(GribMessageHandler* container) override;
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed layout of all fields in section.
+    static constexpr auto octetLayout();
+
     CodeTableProperty source_of_grid_definition_;
     NumberProperty<uint32_t> number_of_data_points_;
     NumberProperty<uint8_t> number_of_octects_for_number_of_points_;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <grib_coder/grib_section.h>
+#include <grib_coder/grib_template.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_coder/template_code_table_property.h>
 
 namespace grib_coder {
@@ -12,18 +14,38 @@ public:
     GribSection4();
     explicit GribSection4(int section_length);
 
-    bool parseFile(std::FILE* file, bool header_only = false) override;
+    // length of template may be changed, template is regenerated only if template number or length is changed.
+    bool resetSection(long section_length) override;
+
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
 
     bool decode(GribMessageHandler* container) override;
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed fields before template.
+    static constexpr auto octetLayout();
+
     // generate production template. used in TemplateCodeTableProperty.
     void generateProductionTemplate(TemplateComponent* template_component);
 
+    // create template, or take it from spare_templates_.
+    std::unique_ptr<GribTemplate> createProductionTemplate(long template_number, long template_length);
+
     NumberProperty<uint16_t> nv_;
     TemplateCodeTableProperty product_definition_template_number_;
+
+    // template number and length of current template, used to reuse template.
+    long generated_template_number_ = -1;
+    long generated_template_length_ = -1;
+
+    // templates replaced by other templates, with their numbers and lengths.
+    // messages of a file often switch between a few templates, so replaced templates are kept to be used again.
+    std::vector<std::tuple<long, long, std::unique_ptr<GribTemplate>>> spare_templates_;
 };
 
 } // namespace grib_coder
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <grib_coder/grib_section.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/code_table_property.h>
 #include <grib_property/computed/packing_type_property.h>
 
@@ -10,22 +11,37 @@ public:
     GribSection5();
     explicit GribSection5(int section_length);
 
-    bool parseFile(std::FILE* file, bool header_only = false) override;
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
 
     bool decode(GribMessageHandler* container) override;
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed layout of fields shared by template 5.0 and 5.40.
+    static constexpr auto octetLayout();
+
+    // fields only in template 5.40, after the end of template 5.0.
+    static constexpr auto jpeg2000OctetLayout();
+
+    // template 5.0 is shorter than template 5.40.
+    bool hasJpeg2000Fields() const;
+
     NumberProperty<uint32_t> number_of_values_;
     CodeTableProperty data_representation_template_number_;
 
+    // Template 5.0 Grid point data - simple packing
     // Template 5.40 Grid point data - JPEG 2000 code stream format
     NumberProperty<float> reference_value_; // NOTE: check std::numeric_limits<T>::is_iec559
     NumberProperty<int16_t> binary_scale_factor_;
     NumberProperty<int16_t> decimal_scale_factor_;
     NumberProperty<uint8_t> bits_per_value_;
     CodeTableProperty type_of_original_field_values_;
+
+    // Template 5.40 only
     CodeTableProperty type_of_compression_used_;
     NumberProperty<uint8_t> target_compression_ratio_;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <grib_coder/grib_section.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/computed/bit_map_values_property.h>
 
 namespace grib_coder {
@@ -11,15 +12,24 @@ public:
     GribSection6();
     explicit GribSection6(int section_length);
 
-    bool parseFile(std::FILE* file, bool header_only = false) override;
+    // length of bitmap may be changed.
+    bool resetSection(long section_length) override;
+
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
 
     bool decode(GribMessageHandler* handler) override;
 
     bool decodeValues(GribMessageHandler* handler);
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed layout of all fields in section.
+    static constexpr auto octetLayout();
+
     NumberProperty<uint8_t> bit_map_indicator_;
     BitMapValuesProperty bit_map_values_;
 };
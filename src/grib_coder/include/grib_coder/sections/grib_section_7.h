@@ -10,14 +10,31 @@ public:
     GribSection7();
     explicit GribSection7(int section_length);
 
+    // length of data values may be changed.
+    bool resetSection(long section_length) override;
+
+    // in header only mode, data values are not read. Section records its offset in file
+    // and reads them when decodeValues() is called, so file should be kept open until then.
     bool parseFile(std::FILE* file, bool header_only = false) override;
 
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
+
     bool decode(GribMessageHandler* container) override;
 
+    // after releaseRawValues(), values decoded before are kept, and false is returned if there are none.
     bool decodeValues(GribMessageHandler* container);
 
+    // decode values into buffer of caller, see DataValuesProperty::decodeValues.
+    // after releaseRawValues(), values decoded before are copied.
+    bool decodeValues(GribMessageHandler* container, gsl::span<double> values);
+    bool decodeValues(GribMessageHandler* container, gsl::span<float> values);
+
     bool encodeValues(GribMessageHandler* container);
 
+    // drop data values read in header only mode or encoded, after values are decoded.
+    // section can't be packed until values are encoded again.
+    void releaseRawValues();
+
     bool encode(GribMessageHandler* handler) override;
 
     void pack(std::back_insert_iterator<std::vector<std::byte>>& iterator) override;
@@ -25,9 +42,27 @@ public:
 private:
     void init();
 
+    // add component of data values, or update its length if it exists.
+    void setDataValuesComponent(long byte_count);
+
+    // read data values skipped by parseFile in header only mode.
+    bool loadDeferredValues();
+
     void updateSectionLength() override;
 
+    template <typename T>
+    bool decodeValuesInto(GribMessageHandler* container, gsl::span<T> values);
+
     DataValuesProperty data_values_;
+
+    // file and offset of data values which are not read yet.
+    std::FILE* deferred_file_ = nullptr;
+    long deferred_offset_ = 0;
+
+    bool raw_values_released_ = false;
+
+    // whether data values are decoded from current bytes.
+    bool values_decoded_ = false;
 };
 
 } // namespace grib_coder
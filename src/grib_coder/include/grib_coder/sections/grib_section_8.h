@@ -11,6 +11,8 @@ public:
 
     bool parseFile(std::FILE* file, bool header_only = false) override;
 
+    bool parseBytes(gsl::span<const std::byte> bytes, bool header_only = false) override;
+
 private:
     void init();
 
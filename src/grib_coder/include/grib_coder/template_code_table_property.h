@@ -17,7 +17,7 @@ public:
     void setTemplateComponent(TemplateComponent* template_component);
 
     // parse CodeTableProperty and create template in TemplateComponent using generate_function
-    bool parse(std::vector<std::byte>::const_iterator& iterator, size_t count = 1) override;
+    bool parse(const std::byte*& iterator, size_t count = 1) override;
 
     void setLong(long value) override;
     void setDouble(double value) override;
@@ -18,7 +18,10 @@ public:
 
     void setTemplate(std::unique_ptr<GribTemplate>&& grib_template);
 
-    bool parse(std::vector<std::byte>::const_iterator& iterator) override;
+    // take template out of component, such as keeping it to be used again.
+    std::unique_ptr<GribTemplate> releaseTemplate();
+
+    bool parse(const std::byte*& iterator) override;
 
     bool decode(GribMessageHandler* handler) override;
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <grib_coder/grib_template.h>
+#include <grib_coder/octet_layout.h>
 
 #include <grib_property/code_table_property.h>
 #include <grib_property/number_property.h>
@@ -7,19 +8,30 @@
 #include <grib_property/computed/type_of_level_property.h>
 #include <grib_property/computed/step_range_property.h>
 
+#include <gsl/span>
+
 namespace grib_coder {
 
 class Template_4_8 final: public GribTemplate {
 public:
     Template_4_8(int template_length);
 
+    // unpack all fields in one pass.
+    bool parse(const std::byte*& iterator) override;
+
     bool decode(GribMessageHandler* handler) override;
 
     void registerProperty(std::shared_ptr<GribSection> &section) override;
 
+    // fields of fixed layout, used to read values from bytes of message without parsing.
+    static gsl::span<const OctetFieldInfo> getOctetFields();
+
 private:
     void init();
 
+    // fixed layout of all fields in template.
+    static constexpr auto octetLayout();
+
     CodeTableProperty parameter_category_;
     CodeTableProperty parameter_number_;
     CodeTableProperty type_of_generating_process_;
@@ -0,0 +1,493 @@
+#include <grib_coder/grib_batch_reader.h>
+#include <grib_coder/grib_message_handler.h>
+#include <grib_property/grib_table_database.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define GRIB_CODER_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+
+namespace grib_coder {
+
+namespace {
+
+// max bytes of one read submitted to io_uring, whose length is 32 bits.
+const uint64_t max_read_length = 1 << 30;
+
+// files of requests, each file is opened once.
+class RequestFiles {
+public:
+    explicit RequestFiles(const std::vector<GribReadRequest>& requests) {
+#ifndef _WIN32
+        for (const auto& request : requests) {
+            if (fds_.find(request.file_path) != std::end(fds_)) {
+                continue;
+            }
+            const auto fd = ::open(request.file_path.c_str(), O_RDONLY);
+            if (fd == -1) {
+                closeFiles();
+                throw std::runtime_error(fmt::format("can't open file: {}", request.file_path));
+            }
+            fds_[request.file_path] = fd;
+        }
+#endif
+    }
+
+    ~RequestFiles() {
+        closeFiles();
+    }
+
+    RequestFiles(const RequestFiles&) = delete;
+    RequestFiles& operator= (const RequestFiles&) = delete;
+
+    int getFd(const std::string& file_path) const {
+        return fds_.at(file_path);
+    }
+
+    // read bytes in [offset, offset + length) of request's file.
+    bool readRange(const GribReadRequest& request, std::byte* buffer, uint64_t offset, uint64_t length) const {
+#ifdef _WIN32
+        auto f = std::fopen(request.file_path.c_str(), "rb");
+        if (f == nullptr) {
+            return false;
+        }
+        auto result = _fseeki64(f, offset, SEEK_SET) == 0 && std::fread(buffer, 1, length, f) == length;
+        std::fclose(f);
+        return result;
+#else
+        const auto fd = getFd(request.file_path);
+        while (length > 0) {
+            const auto count = ::pread(fd, buffer, length, offset);
+            if (count == -1 && errno == EINTR) {
+                continue;
+            }
+            if (count <= 0) {
+                return false;
+            }
+            buffer += count;
+            offset += count;
+            length -= count;
+        }
+        return true;
+#endif
+    }
+
+private:
+    void closeFiles() {
+#ifndef _WIN32
+        for (const auto& item : fds_) {
+            ::close(item.second);
+        }
+#endif
+        fds_.clear();
+    }
+
+    std::unordered_map<std::string, int> fds_;
+};
+
+} // namespace
+
+#ifdef GRIB_CODER_IO_URING
+
+// a minimal io_uring using system calls, which only submits reads.
+struct GribBatchReader::IoUring {
+    ~IoUring() {
+        if (sqes != MAP_FAILED) {
+            ::munmap(sqes, sqes_size);
+        }
+        if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+            ::munmap(cq_ring, cq_ring_size);
+        }
+        if (sq_ring != MAP_FAILED) {
+            ::munmap(sq_ring, sq_ring_size);
+        }
+        if (ring_fd != -1) {
+            ::close(ring_fd);
+        }
+    }
+
+    // return nullptr if io_uring is not supported or not allowed.
+    static std::unique_ptr<IoUring> create(unsigned entries) {
+        io_uring_params params{};
+        const auto fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (fd < 0) {
+            return nullptr;
+        }
+
+        auto ring = std::make_unique<IoUring>();
+        ring->ring_fd = fd;
+        ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const auto single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (single_mmap) {
+            ring->sq_ring_size = std::max(ring->sq_ring_size, ring->cq_ring_size);
+        }
+
+        ring->sq_ring = ::mmap(nullptr, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                               MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+        if (ring->sq_ring == MAP_FAILED) {
+            return nullptr;
+        }
+        if (single_mmap) {
+            ring->cq_ring = ring->sq_ring;
+        } else {
+            ring->cq_ring = ::mmap(nullptr, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                                   MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+            if (ring->cq_ring == MAP_FAILED) {
+                return nullptr;
+            }
+        }
+        ring->sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+        auto sqes = ::mmap(nullptr, ring->sqes_size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED) {
+            return nullptr;
+        }
+        ring->sqes = static_cast<io_uring_sqe*>(sqes);
+
+        auto sq_base = static_cast<char*>(ring->sq_ring);
+        ring->sq_head = reinterpret_cast<unsigned*>(sq_base + params.sq_off.head);
+        ring->sq_tail = reinterpret_cast<unsigned*>(sq_base + params.sq_off.tail);
+        ring->sq_mask = reinterpret_cast<unsigned*>(sq_base + params.sq_off.ring_mask);
+        ring->sq_array = reinterpret_cast<unsigned*>(sq_base + params.sq_off.array);
+        ring->sq_entries = params.sq_entries;
+
+        auto cq_base = static_cast<char*>(ring->cq_ring);
+        ring->cq_head = reinterpret_cast<unsigned*>(cq_base + params.cq_off.head);
+        ring->cq_tail = reinterpret_cast<unsigned*>(cq_base + params.cq_off.tail);
+        ring->cq_mask = reinterpret_cast<unsigned*>(cq_base + params.cq_off.ring_mask);
+        ring->cqes = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+
+        return ring;
+    }
+
+    // add a read into submission queue, return false if queue is full.
+    bool queueRead(int fd, std::byte* buffer, uint64_t offset, uint32_t length, uint64_t user_data) {
+        const auto tail = *sq_tail;
+        const auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+        if (tail - head >= sq_entries) {
+            return false;
+        }
+        const auto index = tail & *sq_mask;
+        auto& sqe = sqes[index];
+        sqe = io_uring_sqe{};
+        sqe.opcode = IORING_OP_READ;
+        sqe.fd = fd;
+        sqe.addr = reinterpret_cast<uint64_t>(buffer);
+        sqe.len = length;
+        sqe.off = offset;
+        sqe.user_data = user_data;
+        sq_array[index] = index;
+        __atomic_store_n(sq_tail, tail + 1, __ATOMIC_RELEASE);
+        pending_count++;
+        return true;
+    }
+
+    // submit queued reads and wait for at least one completion.
+    void submitAndWait() {
+        while (true) {
+            const auto result = ::syscall(__NR_io_uring_enter, ring_fd, pending_count, 1,
+                                          IORING_ENTER_GETEVENTS, nullptr, 0);
+            if (result >= 0) {
+                pending_count -= static_cast<unsigned>(result);
+                return;
+            }
+            if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+                throw std::runtime_error(fmt::format("io_uring_enter failed: {}", errno));
+            }
+        }
+    }
+
+    // get next completion, return false if there is no completion.
+    bool popCompletion(uint64_t& user_data, int& result) {
+        const auto head = *cq_head;
+        if (head == __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE)) {
+            return false;
+        }
+        const auto& cqe = cqes[head & *cq_mask];
+        user_data = cqe.user_data;
+        result = cqe.res;
+        __atomic_store_n(cq_head, head + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    int ring_fd = -1;
+
+    void* sq_ring = MAP_FAILED;
+    size_t sq_ring_size = 0;
+    void* cq_ring = MAP_FAILED;
+    size_t cq_ring_size = 0;
+    io_uring_sqe* sqes = static_cast<io_uring_sqe*>(MAP_FAILED);
+    size_t sqes_size = 0;
+
+    unsigned* sq_head = nullptr;
+    unsigned* sq_tail = nullptr;
+    unsigned* sq_mask = nullptr;
+    unsigned* sq_array = nullptr;
+    unsigned sq_entries = 0;
+
+    unsigned* cq_head = nullptr;
+    unsigned* cq_tail = nullptr;
+    unsigned* cq_mask = nullptr;
+    io_uring_cqe* cqes = nullptr;
+
+    // reads added into submission queue but not submitted.
+    unsigned pending_count = 0;
+};
+
+#else
+
+struct GribBatchReader::IoUring {
+};
+
+#endif
+
+GribBatchReader::GribBatchReader(size_t queue_depth, size_t thread_count):
+    queue_depth_{queue_depth == 0 ? 1 : queue_depth},
+    thread_count_{thread_count == 0 ? std::max(1u, std::thread::hardware_concurrency()) : thread_count} {
+    table_database_ = std::make_shared<GribTableDatabase>();
+#ifdef GRIB_CODER_IO_URING
+    io_uring_ = IoUring::create(static_cast<unsigned>(queue_depth_));
+#endif
+}
+
+GribBatchReader::~GribBatchReader() = default;
+
+bool GribBatchReader::isUsingIoUring() const {
+    return io_uring_ != nullptr;
+}
+
+bool GribBatchReader::read(const std::vector<GribReadRequest>& requests, const ReadCallback& callback) {
+    if (!io_uring_) {
+        return readWithThreadPool(requests, callback);
+    }
+
+#ifdef GRIB_CODER_IO_URING
+    RequestFiles files{requests};
+
+    // buffers and bytes read of requests. Buffers must live until their reads are completed.
+    std::vector<std::vector<std::byte>> buffers(requests.size());
+    std::vector<uint64_t> read_lengths(requests.size(), 0);
+
+    auto queue_read = [&](size_t index) {
+        const auto& request = requests[index];
+        const auto read_length = read_lengths[index];
+        const auto length = std::min(request.length - read_length, max_read_length);
+        return io_uring_->queueRead(files.getFd(request.file_path), buffers[index].data() + read_length,
+                                    request.offset + read_length, static_cast<uint32_t>(length), index);
+    };
+
+    size_t next_request = 0;
+    size_t in_flight_count = 0;
+    auto result = true;
+    std::exception_ptr callback_error;
+
+    auto complete_read = [&](size_t index) {
+        try {
+            callback(index, std::move(buffers[index]));
+        } catch (...) {
+            callback_error = std::current_exception();
+            result = false;
+        }
+    };
+
+    // stop submitting after a failure, but wait for reads in flight because they write into buffers.
+    while (in_flight_count > 0 || (result && next_request < requests.size())) {
+        while (result && next_request < requests.size() && in_flight_count < queue_depth_) {
+            buffers[next_request].resize(requests[next_request].length);
+            if (requests[next_request].length == 0) {
+                complete_read(next_request++);
+                continue;
+            }
+            if (!queue_read(next_request)) {
+                break;
+            }
+            in_flight_count++;
+            next_request++;
+        }
+
+        if (in_flight_count == 0) {
+            continue;
+        }
+
+        io_uring_->submitAndWait();
+
+        uint64_t index = 0;
+        int read_result = 0;
+        while (io_uring_->popCompletion(index, read_result)) {
+            in_flight_count--;
+            if (!result) {
+                continue;
+            }
+
+            const auto& request = requests[index];
+            const auto read_length = read_lengths[index];
+            if (read_result == -EINTR || read_result == -EAGAIN) {
+                read_result = 0;
+            } else if (read_result < 0) {
+                // read operation may be not supported by kernel, read remaining bytes with pread.
+                if (!files.readRange(request, buffers[index].data() + read_length,
+                                     request.offset + read_length, request.length - read_length)) {
+                    result = false;
+                    continue;
+                }
+                read_result = static_cast<int>(request.length - read_length);
+            } else if (read_result == 0) {
+                // end of file
+                result = false;
+                continue;
+            }
+
+            read_lengths[index] += read_result;
+            if (read_lengths[index] < request.length) {
+                if (queue_read(index)) {
+                    in_flight_count++;
+                    continue;
+                }
+                // submission queue is full, read remaining bytes with pread.
+                const auto new_read_length = read_lengths[index];
+                if (!files.readRange(request, buffers[index].data() + new_read_length,
+                                     request.offset + new_read_length, request.length - new_read_length)) {
+                    result = false;
+                    continue;
+                }
+            }
+            complete_read(index);
+        }
+    }
+
+    if (callback_error) {
+        std::rethrow_exception(callback_error);
+    }
+    return result;
+#else
+    return false;
+#endif
+}
+
+bool GribBatchReader::readWithThreadPool(const std::vector<GribReadRequest>& requests, const ReadCallback& callback) {
+    RequestFiles files{requests};
+
+    // requests are taken in order, and reads started but not taken by callback are bounded by queue depth
+    // as in io_uring path.
+    size_t next_request = 0;
+    size_t in_flight_count = 0;
+    std::mutex mutex;
+    std::condition_variable completed_not_empty;
+    std::condition_variable completed_not_full;
+    bool stopped = false;
+
+    // index, bytes and whether read succeeds.
+    std::deque<std::tuple<size_t, std::vector<std::byte>, bool>> completed_reads;
+
+    auto read_requests = [&]() {
+        while (true) {
+            size_t index = 0;
+            {
+                std::unique_lock<std::mutex> lock{mutex};
+                completed_not_full.wait(lock, [&]() {
+                    return in_flight_count < queue_depth_ || stopped;
+                });
+                if (stopped || next_request >= requests.size()) {
+                    return;
+                }
+                index = next_request++;
+                in_flight_count++;
+            }
+
+            const auto& request = requests[index];
+            std::vector<std::byte> buffer(request.length);
+            const auto result = files.readRange(request, buffer.data(), request.offset, request.length);
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                completed_reads.emplace_back(index, std::move(buffer), result);
+            }
+            completed_not_empty.notify_one();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    const auto thread_count = std::min(thread_count_, requests.size());
+    for (size_t i = 0; i < thread_count; i++) {
+        threads.emplace_back(read_requests);
+    }
+
+    auto result = true;
+    std::exception_ptr callback_error;
+    for (size_t i = 0; i < requests.size(); i++) {
+        std::unique_lock<std::mutex> lock{mutex};
+        completed_not_empty.wait(lock, [&]() {
+            return !completed_reads.empty();
+        });
+        auto completed_read = std::move(completed_reads.front());
+        completed_reads.pop_front();
+        in_flight_count--;
+        lock.unlock();
+        completed_not_full.notify_one();
+
+        if (!std::get<2>(completed_read)) {
+            result = false;
+            break;
+        }
+
+        try {
+            callback(std::get<0>(completed_read), std::move(std::get<1>(completed_read)));
+        } catch (...) {
+            callback_error = std::current_exception();
+            break;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopped = true;
+    }
+    completed_not_full.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    if (callback_error) {
+        std::rethrow_exception(callback_error);
+    }
+    return result;
+}
+
+bool GribBatchReader::readMessages(const std::vector<GribReadRequest>& requests, const MessageCallback& callback,
+                                   bool header_only) {
+    return read(requests, [&](size_t index, std::vector<std::byte>&& bytes) {
+        auto message_handler = std::make_unique<GribMessageHandler>(table_database_, header_only);
+        if (!message_handler->parseBuffer(std::move(bytes))) {
+            throw std::runtime_error(fmt::format(
+                "message can't be parsed at offset {} of {}", requests[index].offset, requests[index].file_path));
+        }
+        message_handler->setLong("offset", requests[index].offset);
+        if (requests[index].count != 0) {
+            message_handler->setCount(requests[index].count);
+        }
+        callback(index, std::move(message_handler));
+    });
+}
+
+} // namespace grib_coder
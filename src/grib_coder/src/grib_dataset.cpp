@@ -0,0 +1,225 @@
+#include <grib_coder/grib_dataset.h>
+#include <grib_coder/grib_batch_reader.h>
+#include <grib_coder/grib_file_handler.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+namespace grib_coder {
+
+namespace {
+
+const std::vector<std::string> grib_file_extensions{".grb2", ".grib2", ".grb", ".grib"};
+
+// index of each file is saved as "<file>.idx" next to it.
+const std::string index_file_extension{".idx"};
+
+// match name with pattern which may contain '*' for any characters and '?' for one character.
+bool match_file_name(const std::string& pattern, const std::string& name) {
+    size_t pattern_pos = 0;
+    size_t name_pos = 0;
+    auto star_pos = std::string::npos;
+    size_t star_name_pos = 0;
+
+    while (name_pos < name.size()) {
+        if (pattern_pos < pattern.size()
+            && (pattern[pattern_pos] == '?' || pattern[pattern_pos] == name[name_pos])) {
+            pattern_pos++;
+            name_pos++;
+        } else if (pattern_pos < pattern.size() && pattern[pattern_pos] == '*') {
+            star_pos = pattern_pos++;
+            star_name_pos = name_pos;
+        } else if (star_pos != std::string::npos) {
+            pattern_pos = star_pos + 1;
+            name_pos = ++star_name_pos;
+        } else {
+            return false;
+        }
+    }
+
+    while (pattern_pos < pattern.size() && pattern[pattern_pos] == '*') {
+        pattern_pos++;
+    }
+    return pattern_pos == pattern.size();
+}
+
+std::vector<std::string> list_files(const std::string& path) {
+    namespace fs = std::filesystem;
+
+    fs::path directory{path};
+    std::string pattern;
+    const auto is_directory = fs::is_directory(directory);
+    if (!is_directory) {
+        pattern = directory.filename().string();
+        directory = directory.parent_path();
+        if (directory.empty()) {
+            directory = ".";
+        }
+    }
+
+    std::vector<std::string> files;
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        const auto file_name = entry.path().filename().string();
+
+        // index files match patterns of grib files, such as gmf.gra.*.
+        if (entry.path().extension() == index_file_extension) {
+            continue;
+        }
+        if (is_directory) {
+            const auto extension = entry.path().extension().string();
+            if (std::find(std::begin(grib_file_extensions), std::end(grib_file_extensions), extension)
+                == std::end(grib_file_extensions)) {
+                continue;
+            }
+        } else if (!match_file_name(pattern, file_name)) {
+            continue;
+        }
+        files.push_back(entry.path().string());
+    }
+
+    std::sort(std::begin(files), std::end(files));
+    return files;
+}
+
+std::shared_ptr<GribIndex> build_index(const std::string& file_path) {
+    auto index = std::make_shared<GribIndex>();
+    if (!index->buildFromFile(file_path)) {
+        throw std::runtime_error(fmt::format("can't open file: {}", file_path));
+    }
+    return index;
+}
+
+} // namespace
+
+GribDataset::GribDataset(const std::string& path, bool header_only):
+    header_only_{header_only},
+    files_{list_files(path)} {
+    for (const auto& file_path : files_) {
+        DatasetFile dataset_file;
+        dataset_file.path = file_path;
+        dataset_files_.push_back(std::move(dataset_file));
+    }
+}
+
+GribDataset::~GribDataset() {
+    for (auto& dataset_file : dataset_files_) {
+        dataset_file.handler.reset();
+        if (dataset_file.file != nullptr) {
+            std::fclose(dataset_file.file);
+        }
+    }
+}
+
+void GribDataset::loadIndex(bool save_index) {
+    records_.clear();
+
+    for (size_t file_index = 0; file_index < dataset_files_.size(); file_index++) {
+        auto& dataset_file = dataset_files_[file_index];
+        const auto index_file_path = dataset_file.path + index_file_extension;
+        const auto file_size = std::filesystem::file_size(dataset_file.path);
+
+        auto index = std::make_shared<GribIndex>();
+        if (!index->readFile(index_file_path) || index->getFileSize() != file_size) {
+            index = build_index(dataset_file.path);
+            if (save_index && !index->writeFile(index_file_path)) {
+                fmt::print(stderr, "can't write index file: {}\n", index_file_path);
+            }
+        }
+
+        for (const auto& record : index->records()) {
+            GribDatasetRecord dataset_record;
+            dataset_record.file_index = file_index;
+            dataset_record.record = record;
+            records_.push_back(std::move(dataset_record));
+        }
+
+        // handler opened before uses old index.
+        dataset_file.index = index;
+        dataset_file.handler.reset();
+    }
+
+    index_loaded_ = true;
+}
+
+const std::vector<GribDatasetRecord>& GribDataset::records() {
+    if (!index_loaded_) {
+        loadIndex();
+    }
+    return records_;
+}
+
+std::vector<GribDatasetRecord> GribDataset::findRecords(
+    const std::vector<std::tuple<std::string, std::string>>& conditions) {
+    std::vector<GribDatasetRecord> found_records;
+    for (const auto& dataset_record : records()) {
+        if (match_conditions(dataset_record.record, conditions)) {
+            found_records.push_back(dataset_record);
+        }
+    }
+    return found_records;
+}
+
+std::unique_ptr<GribMessageHandler> GribDataset::getMessage(const GribDatasetRecord& record) {
+    auto handler = getFileHandler(record.file_index);
+    return handler->messageAtOffset(record.record.offset);
+}
+
+std::vector<std::unique_ptr<GribMessageHandler>> GribDataset::findMessages(
+    const std::vector<std::tuple<std::string, std::string>>& conditions) {
+    const auto found_records = findRecords(conditions);
+
+    // messages are scattered in many files, so read them in one batch.
+    std::vector<GribReadRequest> requests;
+    for (const auto& record : found_records) {
+        GribReadRequest request;
+        request.file_path = files_[record.file_index];
+        request.offset = record.record.offset;
+        request.length = record.record.length;
+        request.count = record.record.count;
+        requests.push_back(std::move(request));
+    }
+
+    std::vector<std::unique_ptr<GribMessageHandler>> message_handlers(found_records.size());
+    if (!batch_reader_) {
+        batch_reader_ = std::make_unique<GribBatchReader>();
+    }
+    const auto result = batch_reader_->readMessages(
+        requests,
+        [&](size_t index, std::unique_ptr<GribMessageHandler>&& message_handler) {
+            message_handlers[index] = std::move(message_handler);
+        },
+        header_only_);
+    if (!result) {
+        throw std::runtime_error("read messages failed");
+    }
+    return message_handlers;
+}
+
+GribFileHandler* GribDataset::getFileHandler(size_t file_index) {
+    if (!index_loaded_) {
+        loadIndex();
+    }
+
+    auto& dataset_file = dataset_files_.at(file_index);
+    if (dataset_file.handler) {
+        return dataset_file.handler.get();
+    }
+
+    if (dataset_file.file == nullptr) {
+        dataset_file.file = std::fopen(dataset_file.path.c_str(), "rb");
+        if (dataset_file.file == nullptr) {
+            throw std::runtime_error(fmt::format("can't open file: {}", dataset_file.path));
+        }
+    }
+    dataset_file.handler = std::make_unique<GribFileHandler>(dataset_file.file, dataset_file.index, header_only_);
+    dataset_file.handler->setAccessPattern(GribAccessPattern::Random);
+    return dataset_file.handler.get();
+}
+
+} // namespace grib_coder
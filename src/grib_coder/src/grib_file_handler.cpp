@@ -1,24 +1,242 @@
 #include <grib_coder/grib_file_handler.h>
+#include <grib_coder/grib_mapped_file.h>
+#include <grib_coder/grib_index.h>
+#include <grib_coder/grib_parallel_scanner.h>
 #include <grib_property/grib_table_database.h>
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <fcntl.h>
+#endif
+
 namespace grib_coder {
 
+namespace {
+
+// bytes prefetched after current message in sequential access.
+const uint64_t sequential_readahead_length = 4 << 20;
+
+} // namespace
+
 GribFileHandler::GribFileHandler(std::FILE* file, bool header_only):
     header_only_{header_only},
     file_{file} {
     table_database_ = std::make_shared<GribTableDatabase>();
 }
 
+GribFileHandler::GribFileHandler(std::shared_ptr<GribMappedFile> mapped_file, bool header_only):
+    header_only_{header_only},
+    mapped_file_{std::move(mapped_file)} {
+    table_database_ = std::make_shared<GribTableDatabase>();
+}
+
+GribFileHandler::GribFileHandler(std::FILE* file, std::shared_ptr<GribIndex> index, bool header_only):
+    header_only_{header_only},
+    file_{file},
+    index_{std::move(index)} {
+    table_database_ = std::make_shared<GribTableDatabase>();
+
+    // offsets in an index of an old file point to wrong messages.
+    const auto current_pos = std::ftell(file_);
+    std::fseek(file_, 0, SEEK_END);
+    const auto file_size = static_cast<uint64_t>(std::ftell(file_));
+    std::fseek(file_, current_pos, SEEK_SET);
+    if (index_ && index_->getFileSize() != file_size) {
+        throw std::runtime_error(fmt::format(
+            "index is out of date: file size {} in index, but {} in file", index_->getFileSize(), file_size));
+    }
+}
+
+void GribFileHandler::setAccessPattern(GribAccessPattern pattern) {
+    access_pattern_ = pattern;
+
+    // header only scans skip section 7, so larger readahead of sequential access would read data values anyway.
+    const auto kernel_pattern =
+        (pattern == GribAccessPattern::Sequential && header_only_) ? GribAccessPattern::Normal : pattern;
+    if (mapped_file_) {
+        mapped_file_->setAccessPattern(kernel_pattern);
+        return;
+    }
+#ifdef __linux__
+    auto advice = POSIX_FADV_NORMAL;
+    if (kernel_pattern == GribAccessPattern::Sequential) {
+        advice = POSIX_FADV_SEQUENTIAL;
+    } else if (kernel_pattern == GribAccessPattern::Random) {
+        advice = POSIX_FADV_RANDOM;
+    }
+    ::posix_fadvise(fileno(file_), 0, 0, advice);
+#endif
+}
+
 std::unique_ptr<GribMessageHandler> GribFileHandler::next() {
+    return next(nullptr);
+}
+
+std::unique_ptr<GribMessageHandler> GribFileHandler::next(std::unique_ptr<GribMessageHandler> message_handler) {
     count_ += 1;
-    auto message_handler = std::make_unique<GribMessageHandler>(table_database_, header_only_);
-    const auto result = message_handler->parseFile(file_);
+    if (!message_handler) {
+        message_handler = std::make_unique<GribMessageHandler>(table_database_, header_only_);
+    }
+    bool result = false;
+    if (mapped_file_) {
+        result = message_handler->parseMappedFile(mapped_file_, position_);
+        if (result) {
+            position_ += message_handler->getLong("totalLength");
+        }
+    } else {
+        result = message_handler->parseFile(file_);
+    }
     if (result) {
         message_handler->setCount(count_);
+        if (access_pattern_ == GribAccessPattern::Sequential) {
+            adviseSequentialAccess(message_handler->getLong("offset"), message_handler->getLong("totalLength"));
+        }
         return message_handler;
     }
 
     return nullptr;
 }
 
+std::vector<std::unique_ptr<GribMessageHandler>> GribFileHandler::findMessages(
+    const std::vector<std::tuple<std::string, std::string>>& conditions) {
+    if (!index_) {
+        throw std::runtime_error("index is not set");
+    }
+
+    const auto records = index_->findRecords(conditions);
+
+    // let kernel read all found messages at the same time.
+    if (access_pattern_ == GribAccessPattern::Random) {
+        for (const auto& record : records) {
+            willNeed(record.offset, record.length);
+        }
+    }
+
+    std::vector<std::unique_ptr<GribMessageHandler>> message_handlers;
+    for (const auto& record : records) {
+        auto message_handler = parseMessageAt(record.offset, record.count);
+        if (!message_handler) {
+            throw std::runtime_error(fmt::format("message can't be parsed at offset {}", record.offset));
+        }
+        message_handlers.push_back(std::move(message_handler));
+    }
+    return message_handlers;
+}
+
+std::unique_ptr<GribMessageHandler> GribFileHandler::messageAt(size_t index) {
+    loadMessageLocations();
+    if (index >= message_locations_.size()) {
+        return nullptr;
+    }
+    return parseMessageAt(message_locations_[index].offset, index + 1);
+}
+
+std::unique_ptr<GribMessageHandler> GribFileHandler::messageAtOffset(uint64_t offset) {
+    loadMessageLocations();
+    const auto iter = std::lower_bound(
+        std::begin(message_locations_), std::end(message_locations_), offset,
+        [](const GribMessageLocation& location, uint64_t value) {
+            return location.offset < value;
+        });
+    if (iter == std::end(message_locations_) || iter->offset != offset) {
+        return nullptr;
+    }
+    return parseMessageAt(offset, std::distance(std::begin(message_locations_), iter) + 1);
+}
+
+size_t GribFileHandler::getMessageCount() {
+    loadMessageLocations();
+    return message_locations_.size();
+}
+
+std::unique_ptr<GribMessageHandler> GribFileHandler::parseMessageAt(uint64_t offset, uint64_t count) {
+    auto message_handler = std::make_unique<GribMessageHandler>(table_database_, header_only_);
+    bool result = false;
+    if (mapped_file_) {
+        result = message_handler->parseMappedFile(mapped_file_, offset);
+    } else {
+        std::fseek(file_, offset, SEEK_SET);
+        result = message_handler->parseFile(file_);
+    }
+    if (!result) {
+        return nullptr;
+    }
+    message_handler->setCount(count);
+
+    // next() continues after this message.
+    count_ = count;
+    position_ = offset + message_handler->getLong("totalLength");
+
+    return message_handler;
+}
+
+void GribFileHandler::loadMessageLocations() {
+    if (message_locations_loaded_) {
+        return;
+    }
+
+    if (index_) {
+        for (const auto& record : index_->records()) {
+            GribMessageLocation location;
+            location.offset = record.offset;
+            location.length = record.length;
+            location.discipline = record.discipline;
+            message_locations_.push_back(location);
+        }
+    } else if (mapped_file_) {
+        message_locations_ = GribParallelScanner(mapped_file_).scan();
+    } else {
+        const auto current_pos = std::ftell(file_);
+        std::fseek(file_, 0, SEEK_SET);
+        message_locations_ = GribScanner(file_).scan();
+        std::fseek(file_, current_pos, SEEK_SET);
+    }
+
+    message_locations_loaded_ = true;
+}
+
+void GribFileHandler::willNeed(uint64_t offset, uint64_t length) {
+    if (mapped_file_) {
+        mapped_file_->willNeed(offset, length);
+        return;
+    }
+#ifdef __linux__
+    ::posix_fadvise(fileno(file_), offset, length, POSIX_FADV_WILLNEED);
+#endif
+}
+
+void GribFileHandler::dontNeed(uint64_t offset, uint64_t length) {
+    if (mapped_file_) {
+        mapped_file_->dontNeed(offset, length);
+        return;
+    }
+#ifdef __linux__
+    ::posix_fadvise(fileno(file_), offset, length, POSIX_FADV_DONTNEED);
+#endif
+}
+
+void GribFileHandler::adviseSequentialAccess(uint64_t offset, uint64_t length) {
+    // keep pages of current message, which may be used by data values in header only mode.
+    if (offset > dropped_position_) {
+        dontNeed(dropped_position_, offset - dropped_position_);
+        dropped_position_ = offset;
+    }
+
+    // prefetch next bytes when less than half of prefetched bytes are left.
+    // bytes are not prefetched in header only mode, which doesn't read section 7.
+    if (header_only_) {
+        return;
+    }
+    const auto end_position = offset + length;
+    if (end_position + sequential_readahead_length / 2 > prefetched_position_) {
+        const auto begin_position = std::max(end_position, prefetched_position_);
+        prefetched_position_ = end_position + sequential_readahead_length;
+        willNeed(begin_position, prefetched_position_ - begin_position);
+    }
+}
+
 } // namespace grib_coder
@@ -0,0 +1,156 @@
+#include <grib_coder/grib_follow_file_handler.h>
+#include <grib_property/grib_table_database.h>
+#include <grib_property/number_convert.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace grib_coder {
+
+namespace {
+
+// max time between two checks of file size, used when inotify is not available or misses changes,
+// such as writes from other hosts on a network file system.
+const std::chrono::milliseconds follow_poll_interval{500};
+
+} // namespace
+
+GribFollowFileHandler::GribFollowFileHandler(
+    const std::string& file_path, bool header_only, std::chrono::milliseconds idle_timeout):
+    file_path_{file_path},
+    header_only_{header_only},
+    idle_timeout_{idle_timeout} {
+    table_database_ = std::make_shared<GribTableDatabase>();
+    file_ = std::fopen(file_path.c_str(), "rb");
+    if (file_ == nullptr) {
+        throw std::runtime_error(fmt::format("can't open file: {}", file_path));
+    }
+
+#ifdef __linux__
+    inotify_fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotify_fd_ != -1
+        && ::inotify_add_watch(inotify_fd_, file_path.c_str(), IN_MODIFY | IN_CLOSE_WRITE) == -1) {
+        ::close(inotify_fd_);
+        inotify_fd_ = -1;
+    }
+#endif
+}
+
+GribFollowFileHandler::~GribFollowFileHandler() {
+#ifdef __linux__
+    if (inotify_fd_ != -1) {
+        ::close(inotify_fd_);
+    }
+#endif
+    std::fclose(file_);
+}
+
+std::unique_ptr<GribMessageHandler> GribFollowFileHandler::next(std::unique_ptr<GribMessageHandler> message_handler) {
+    const auto start_time = std::chrono::steady_clock::now();
+
+    uint64_t total_length = 0;
+    while (true) {
+        const auto state = checkNextMessage(total_length);
+        if (state == MessageState::Complete) {
+            break;
+        }
+        if (state == MessageState::Invalid) {
+            return nullptr;
+        }
+
+        auto timeout = follow_poll_interval;
+        if (idle_timeout_.count() > 0) {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start_time);
+            if (elapsed >= idle_timeout_) {
+                return nullptr;
+            }
+            timeout = std::min(timeout, idle_timeout_ - elapsed);
+        }
+        waitForChange(timeout);
+    }
+
+    if (!message_handler) {
+        message_handler = std::make_unique<GribMessageHandler>(table_database_, header_only_);
+    }
+
+    std::fseek(file_, completed_offset_, SEEK_SET);
+    if (!message_handler->parseFile(file_)) {
+        return nullptr;
+    }
+
+    count_ += 1;
+    message_handler->setCount(count_);
+    completed_offset_ += total_length;
+    return message_handler;
+}
+
+GribFollowFileHandler::MessageState GribFollowFileHandler::checkNextMessage(uint64_t& total_length) {
+    // seeking also drops stdio buffer and end-of-file flag from reads before file grows.
+    std::fseek(file_, 0, SEEK_END);
+    const auto file_size = static_cast<uint64_t>(std::ftell(file_));
+    if (file_size < completed_offset_) {
+        // file is truncated or replaced.
+        return MessageState::Invalid;
+    }
+    if (file_size - completed_offset_ < 16) {
+        return MessageState::Incomplete;
+    }
+
+    std::array<std::byte, 16> header{};
+    std::fseek(file_, completed_offset_, SEEK_SET);
+    if (std::fread(header.data(), 1, header.size(), file_) != header.size()) {
+        return MessageState::Incomplete;
+    }
+    if (std::memcmp(header.data(), "GRIB", 4) != 0) {
+        return MessageState::Invalid;
+    }
+
+    total_length = convert_bytes_to_number<uint64_t>(header.data() + 8);
+    if (total_length < 20) {
+        return MessageState::Invalid;
+    }
+    if (file_size - completed_offset_ < total_length) {
+        return MessageState::Incomplete;
+    }
+
+    // writer may extend file before writing all bytes, so wait until end of message is written.
+    std::array<std::byte, 4> end_bytes{};
+    std::fseek(file_, completed_offset_ + total_length - 4, SEEK_SET);
+    if (std::fread(end_bytes.data(), 1, end_bytes.size(), file_) != end_bytes.size()
+        || std::memcmp(end_bytes.data(), "7777", 4) != 0) {
+        return MessageState::Incomplete;
+    }
+    return MessageState::Complete;
+}
+
+void GribFollowFileHandler::waitForChange(std::chrono::milliseconds timeout) {
+#ifdef __linux__
+    if (inotify_fd_ != -1) {
+        pollfd poll_fd{};
+        poll_fd.fd = inotify_fd_;
+        poll_fd.events = POLLIN;
+        if (::poll(&poll_fd, 1, static_cast<int>(timeout.count())) > 0) {
+            // drop all events, file size is checked again by caller.
+            std::array<char, 4096> events{};
+            while (::read(inotify_fd_, events.data(), events.size()) > 0) {
+            }
+        }
+        return;
+    }
+#endif
+    std::this_thread::sleep_for(timeout);
+}
+
+} // namespace grib_coder
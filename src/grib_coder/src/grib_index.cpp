@@ -0,0 +1,318 @@
+#include <grib_coder/grib_index.h>
+#include <grib_coder/grib_message_handler.h>
+#include <grib_coder/grib_file_handler.h>
+
+#include <grib_property/number_convert.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+namespace grib_coder {
+
+namespace {
+
+const char index_magic[] = "GIDX";
+const uint16_t index_version = 1;
+
+// header: magic, version, file size, record count
+const size_t header_length = 4 + 2 + 8 + 8;
+
+// offset, length, discipline, category, number, date, time and 5 string ids
+const size_t record_length = 8 + 8 + 1 + 1 + 1 + 4 + 2 + 5 * 4;
+
+template <typename T>
+void write_number(std::back_insert_iterator<std::vector<std::byte>>& iterator, T value) {
+    const auto bytes = convert_number_to_bytes<T>(value);
+    std::copy(std::begin(bytes), std::end(bytes), iterator);
+}
+
+template <typename T>
+T read_number(const std::byte*& iterator) {
+    const auto value = convert_bytes_to_number<T>(iterator);
+    iterator += sizeof(T);
+    return value;
+}
+
+} // namespace
+
+std::string GribIndexRecord::getString(const std::string& key) const {
+    if (key == "discipline") {
+        return fmt::format("{}", discipline);
+    } else if (key == "parameterCategory") {
+        return fmt::format("{}", parameter_category);
+    } else if (key == "parameterNumber") {
+        return fmt::format("{}", parameter_number);
+    } else if (key == "typeOfLevel") {
+        return type_of_level;
+    } else if (key == "level") {
+        return level;
+    } else if (key == "stepRange") {
+        return step_range;
+    } else if (key == "dataDate") {
+        return fmt::format("{}", data_date);
+    } else if (key == "dataTime") {
+        return fmt::format("{}", data_time);
+    } else if (key == "gridType") {
+        return grid_type;
+    } else if (key == "packingType") {
+        return packing_type;
+    } else if (key == "count") {
+        return fmt::format("{}", count);
+    } else if (key == "offset") {
+        return fmt::format("{}", offset);
+    }
+    throw std::runtime_error(fmt::format("key is not in index: {}", key));
+}
+
+long GribIndexRecord::getLong(const std::string& key) const {
+    if (key == "discipline") {
+        return discipline;
+    } else if (key == "parameterCategory") {
+        return parameter_category;
+    } else if (key == "parameterNumber") {
+        return parameter_number;
+    } else if (key == "dataDate") {
+        return data_date;
+    } else if (key == "dataTime") {
+        return data_time;
+    } else if (key == "count") {
+        return static_cast<long>(count);
+    } else if (key == "offset") {
+        return static_cast<long>(offset);
+    }
+    throw std::runtime_error(fmt::format("number key is not in index: {}", key));
+}
+
+bool is_code_number_key(const std::string& key) {
+    return key == "discipline" || key == "parameterCategory" || key == "parameterNumber";
+}
+
+const std::vector<std::string>& GribIndex::keys() {
+    static const std::vector<std::string> index_keys{
+        "discipline",
+        "parameterCategory",
+        "parameterNumber",
+        "typeOfLevel",
+        "level",
+        "stepRange",
+        "dataDate",
+        "dataTime",
+        "gridType",
+        "packingType",
+    };
+    return index_keys;
+}
+
+void GribIndex::addMessage(GribMessageHandler* message_handler) {
+    static const KeyId offset_key{"offset"};
+    static const KeyId total_length_key{"totalLength"};
+    static const KeyId discipline_key{"discipline"};
+    static const KeyId parameter_category_key{"parameterCategory"};
+    static const KeyId parameter_number_key{"parameterNumber"};
+    static const KeyId type_of_level_key{"typeOfLevel"};
+    static const KeyId level_key{"level"};
+    static const KeyId step_range_key{"stepRange"};
+    static const KeyId data_date_key{"dataDate"};
+    static const KeyId data_time_key{"dataTime"};
+    static const KeyId grid_type_key{"gridType"};
+    static const KeyId packing_type_key{"packingType"};
+
+    GribIndexRecord record;
+    record.count = records_.size() + 1;
+    record.offset = message_handler->getLong(offset_key);
+    record.length = message_handler->getLong(total_length_key);
+    record.discipline = message_handler->getLong(discipline_key);
+    record.parameter_category = message_handler->getLong(parameter_category_key);
+    record.parameter_number = message_handler->getLong(parameter_number_key);
+    record.type_of_level = message_handler->getString(type_of_level_key);
+    record.level = message_handler->getString(level_key);
+    record.step_range = message_handler->getString(step_range_key);
+    record.data_date = message_handler->getLong(data_date_key);
+    record.data_time = message_handler->getLong(data_time_key);
+    record.grid_type = message_handler->getString(grid_type_key);
+    record.packing_type = message_handler->getString(packing_type_key);
+    records_.push_back(std::move(record));
+}
+
+std::vector<GribIndexRecord> GribIndex::findRecords(
+    const std::vector<std::tuple<std::string, std::string>>& conditions) const {
+    std::vector<GribIndexRecord> found_records;
+    for (const auto& record : records_) {
+        if (match_conditions(record, conditions)) {
+            found_records.push_back(record);
+        }
+    }
+    return found_records;
+}
+
+bool GribIndex::buildFromFile(const std::string& file_path) {
+    auto f = std::fopen(file_path.c_str(), "rb");
+    if (f == nullptr) {
+        return false;
+    }
+
+    records_.clear();
+    file_size_ = std::filesystem::file_size(file_path);
+
+    GribFileHandler handler(f, true);
+    handler.setAccessPattern(GribAccessPattern::Sequential);
+    auto message_handler = handler.next();
+    while (message_handler) {
+        addMessage(message_handler.get());
+        message_handler = handler.next(std::move(message_handler));
+    }
+
+    std::fclose(f);
+    return true;
+}
+
+bool GribIndex::readFile(const std::string& index_file_path) {
+    auto f = std::fopen(index_file_path.c_str(), "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    std::fseek(f, 0, SEEK_END);
+    const auto index_file_size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    if (index_file_size == -1) {
+        std::fclose(f);
+        return false;
+    }
+
+    std::vector<std::byte> buffer(index_file_size);
+    const auto read_count = std::fread(buffer.data(), 1, buffer.size(), f);
+    std::fclose(f);
+    if (read_count != buffer.size() || buffer.size() < header_length + 4) {
+        return false;
+    }
+
+    const std::byte* buffer_end = buffer.data() + buffer.size();
+    const std::byte* iterator = buffer.data();
+
+    if (std::memcmp(iterator, index_magic, 4) != 0) {
+        return false;
+    }
+    iterator += 4;
+    if (read_number<uint16_t>(iterator) != index_version) {
+        return false;
+    }
+    const auto file_size = read_number<uint64_t>(iterator);
+    const auto record_count = read_number<uint64_t>(iterator);
+
+    const auto string_count = read_number<uint32_t>(iterator);
+    std::vector<std::string> string_table;
+    string_table.reserve(string_count);
+    for (uint32_t i = 0; i < string_count; i++) {
+        if (buffer_end - iterator < 2) {
+            return false;
+        }
+        const auto string_length = read_number<uint16_t>(iterator);
+        if (buffer_end - iterator < string_length) {
+            return false;
+        }
+        string_table.emplace_back(reinterpret_cast<const char*>(iterator), string_length);
+        iterator += string_length;
+    }
+
+    // record count is compared by division, which can't overflow as record_count * record_length.
+    const auto records_length = static_cast<uint64_t>(buffer_end - iterator);
+    if (records_length % record_length != 0 || records_length / record_length != record_count) {
+        return false;
+    }
+
+    // a corrupt index makes the caller rebuild it, so string id out of range is not an exception.
+    const auto read_string = [&string_table, &iterator](std::string& value) {
+        const auto id = read_number<uint32_t>(iterator);
+        if (id >= string_table.size()) {
+            return false;
+        }
+        value = string_table[id];
+        return true;
+    };
+
+    std::vector<GribIndexRecord> records;
+    records.reserve(record_count);
+    for (uint64_t i = 0; i < record_count; i++) {
+        GribIndexRecord record;
+        record.count = i + 1;
+        record.offset = read_number<uint64_t>(iterator);
+        record.length = read_number<uint64_t>(iterator);
+        record.discipline = read_number<uint8_t>(iterator);
+        record.parameter_category = read_number<uint8_t>(iterator);
+        record.parameter_number = read_number<uint8_t>(iterator);
+        record.data_date = read_number<uint32_t>(iterator);
+        record.data_time = read_number<uint16_t>(iterator);
+        if (!read_string(record.type_of_level) || !read_string(record.level) || !read_string(record.step_range) ||
+            !read_string(record.grid_type) || !read_string(record.packing_type)) {
+            return false;
+        }
+        records.push_back(std::move(record));
+    }
+
+    records_ = std::move(records);
+    file_size_ = file_size;
+    return true;
+}
+
+bool GribIndex::writeFile(const std::string& index_file_path) const {
+    std::map<std::string, uint32_t> string_ids;
+    std::vector<std::string> string_table;
+    const auto get_string_id = [&string_ids, &string_table](const std::string& value) {
+        const auto iter = string_ids.find(value);
+        if (iter != std::end(string_ids)) {
+            return iter->second;
+        }
+        const auto id = static_cast<uint32_t>(string_table.size());
+        string_ids[value] = id;
+        string_table.push_back(value);
+        return id;
+    };
+
+    std::vector<std::byte> record_bytes;
+    record_bytes.reserve(records_.size() * record_length);
+    auto record_iterator = std::back_inserter(record_bytes);
+    for (const auto& record : records_) {
+        write_number<uint64_t>(record_iterator, record.offset);
+        write_number<uint64_t>(record_iterator, record.length);
+        write_number<uint8_t>(record_iterator, record.discipline);
+        write_number<uint8_t>(record_iterator, record.parameter_category);
+        write_number<uint8_t>(record_iterator, record.parameter_number);
+        write_number<uint32_t>(record_iterator, record.data_date);
+        write_number<uint16_t>(record_iterator, record.data_time);
+        write_number<uint32_t>(record_iterator, get_string_id(record.type_of_level));
+        write_number<uint32_t>(record_iterator, get_string_id(record.level));
+        write_number<uint32_t>(record_iterator, get_string_id(record.step_range));
+        write_number<uint32_t>(record_iterator, get_string_id(record.grid_type));
+        write_number<uint32_t>(record_iterator, get_string_id(record.packing_type));
+    }
+
+    std::vector<std::byte> bytes;
+    auto iterator = std::back_inserter(bytes);
+    std::transform(index_magic, index_magic + 4, iterator, [](char c) { return std::byte(c); });
+    write_number<uint16_t>(iterator, index_version);
+    write_number<uint64_t>(iterator, file_size_);
+    write_number<uint64_t>(iterator, records_.size());
+    write_number<uint32_t>(iterator, string_table.size());
+    for (const auto& value : string_table) {
+        write_number<uint16_t>(iterator, value.size());
+        std::transform(std::begin(value), std::end(value), iterator, [](char c) { return std::byte(c); });
+    }
+    std::copy(std::begin(record_bytes), std::end(record_bytes), iterator);
+
+    auto f = std::fopen(index_file_path.c_str(), "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    const auto write_count = std::fwrite(bytes.data(), 1, bytes.size(), f);
+    std::fclose(f);
+    return write_count == bytes.size();
+}
+
+} // namespace grib_coder
@@ -0,0 +1,45 @@
+#include <grib_coder/grib_key.h>
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+namespace grib_coder {
+
+namespace {
+
+struct KeyRegistry {
+    std::mutex mutex;
+    std::unordered_map<std::string, uint32_t> indexes;
+
+    // names by index, deque keeps references valid when names are added.
+    std::deque<std::string> names;
+};
+
+KeyRegistry& get_key_registry() {
+    static KeyRegistry registry;
+    return registry;
+}
+
+} // namespace
+
+const std::string KeyId::empty_name;
+
+KeyId::KeyId(const std::string& name):
+    hash_{std::hash<std::string>{}(name)} {
+    auto& registry = get_key_registry();
+    std::lock_guard<std::mutex> lock{registry.mutex};
+    const auto iter = registry.indexes.find(name);
+    if (iter != std::end(registry.indexes)) {
+        index_ = iter->second;
+        name_ = &registry.names[index_];
+        return;
+    }
+    index_ = static_cast<uint32_t>(registry.names.size());
+    registry.names.push_back(name);
+    registry.indexes[name] = index_;
+    name_ = &registry.names.back();
+}
+
+} // namespace grib_coder
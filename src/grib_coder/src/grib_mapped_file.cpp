@@ -0,0 +1,138 @@
+#include <grib_coder/grib_mapped_file.h>
+
+#include <fmt/format.h>
+
+#include <stdexcept>
+#include <tuple>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace grib_coder {
+
+#ifdef _WIN32
+
+GribMappedFile::GribMappedFile(const std::string& file_path) {
+    std::ifstream f(file_path, std::ios::binary | std::ios::ate);
+    if (!f) {
+        throw std::runtime_error(fmt::format("can't open file: {}", file_path));
+    }
+    size_ = static_cast<uint64_t>(f.tellg());
+    buffer_.resize(size_);
+    f.seekg(0);
+    f.read(reinterpret_cast<char*>(buffer_.data()), size_);
+    data_ = buffer_.data();
+}
+
+GribMappedFile::~GribMappedFile() = default;
+
+void GribMappedFile::setAccessPattern(GribAccessPattern pattern) const {
+}
+
+void GribMappedFile::willNeed(uint64_t offset, uint64_t length) const {
+}
+
+void GribMappedFile::dontNeed(uint64_t offset, uint64_t length) const {
+}
+
+#else
+
+GribMappedFile::GribMappedFile(const std::string& file_path) {
+    fd_ = ::open(file_path.c_str(), O_RDONLY);
+    if (fd_ == -1) {
+        throw std::runtime_error(fmt::format("can't open file: {}", file_path));
+    }
+
+    struct stat file_stat{};
+    if (::fstat(fd_, &file_stat) == -1) {
+        ::close(fd_);
+        throw std::runtime_error(fmt::format("can't stat file: {}", file_path));
+    }
+    size_ = static_cast<uint64_t>(file_stat.st_size);
+
+    // mmap can't map an empty file.
+    if (size_ == 0) {
+        return;
+    }
+
+    const auto address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (address == MAP_FAILED) {
+        ::close(fd_);
+        throw std::runtime_error(fmt::format("can't map file: {}", file_path));
+    }
+    data_ = static_cast<const std::byte*>(address);
+}
+
+GribMappedFile::~GribMappedFile() {
+    if (data_ != nullptr) {
+        ::munmap(const_cast<std::byte*>(data_), size_);
+    }
+    if (fd_ != -1) {
+        ::close(fd_);
+    }
+}
+
+void GribMappedFile::setAccessPattern(GribAccessPattern pattern) const {
+    if (data_ == nullptr) {
+        return;
+    }
+    auto advice = MADV_NORMAL;
+    if (pattern == GribAccessPattern::Sequential) {
+        advice = MADV_SEQUENTIAL;
+    } else if (pattern == GribAccessPattern::Random) {
+        advice = MADV_RANDOM;
+    }
+    ::madvise(const_cast<std::byte*>(data_), size_, advice);
+}
+
+void GribMappedFile::willNeed(uint64_t offset, uint64_t length) const {
+    const auto range = pageRange(offset, length);
+    if (std::get<1>(range) == 0) {
+        return;
+    }
+    ::madvise(const_cast<std::byte*>(data_) + std::get<0>(range), std::get<1>(range), MADV_WILLNEED);
+}
+
+void GribMappedFile::dontNeed(uint64_t offset, uint64_t length) const {
+    const auto range = pageRange(offset, length);
+    if (std::get<1>(range) == 0) {
+        return;
+    }
+    // unmap pages from this process first, or page cache can't drop them.
+    ::madvise(const_cast<std::byte*>(data_) + std::get<0>(range), std::get<1>(range), MADV_DONTNEED);
+#ifdef __linux__
+    ::posix_fadvise(fd_, std::get<0>(range), std::get<1>(range), POSIX_FADV_DONTNEED);
+#endif
+}
+
+std::tuple<uint64_t, uint64_t> GribMappedFile::pageRange(uint64_t offset, uint64_t length) const {
+    if (data_ == nullptr || offset >= size_) {
+        return {0, 0};
+    }
+    if (length > size_ - offset) {
+        length = size_ - offset;
+    }
+    const auto page_size = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+    const auto begin = offset / page_size * page_size;
+    return {begin, offset + length - begin};
+}
+
+#endif
+
+gsl::span<const std::byte> GribMappedFile::bytes(uint64_t offset, uint64_t length) const {
+    if (offset >= size_) {
+        return {};
+    }
+    if (length > size_ - offset) {
+        length = size_ - offset;
+    }
+    return gsl::span<const std::byte>(data_ + offset, length);
+}
+
+} // namespace grib_coder
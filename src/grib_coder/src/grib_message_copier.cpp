@@ -0,0 +1,199 @@
+#include <grib_coder/grib_message_copier.h>
+#include <grib_coder/grib_file_handler.h>
+#include <grib_coder/grib_index.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+
+namespace grib_coder {
+
+namespace {
+
+// buffer size used when bytes are copied through user space.
+const uint64_t copy_buffer_length = 1 << 20;
+
+} // namespace
+
+#ifdef _WIN32
+
+GribMessageCopier::GribMessageCopier(const std::string& source_path, const std::string& target_path):
+    source_path_{source_path} {
+    source_file_ = std::fopen(source_path.c_str(), "rb");
+    if (source_file_ == nullptr) {
+        throw std::runtime_error(fmt::format("can't open file: {}", source_path));
+    }
+    // opening target truncates it, which would destroy source if they are the same file.
+    std::error_code error;
+    if (std::filesystem::equivalent(source_path, target_path, error)) {
+        std::fclose(source_file_);
+        throw std::runtime_error(fmt::format("target is the same file as source: {}", target_path));
+    }
+    target_file_ = std::fopen(target_path.c_str(), "wb");
+    if (target_file_ == nullptr) {
+        std::fclose(source_file_);
+        throw std::runtime_error(fmt::format("can't open file: {}", target_path));
+    }
+}
+
+GribMessageCopier::~GribMessageCopier() {
+    std::fclose(source_file_);
+    std::fclose(target_file_);
+}
+
+bool GribMessageCopier::copyMessage(uint64_t offset, uint64_t length) {
+    return copyBuffered(offset, length);
+}
+
+bool GribMessageCopier::copyBuffered(uint64_t offset, uint64_t length) {
+    std::vector<std::byte> buffer(std::min(length, copy_buffer_length));
+    std::fseek(source_file_, offset, SEEK_SET);
+    while (length > 0) {
+        const auto count = std::min<uint64_t>(length, buffer.size());
+        if (std::fread(buffer.data(), 1, count, source_file_) != count) {
+            return false;
+        }
+        if (std::fwrite(buffer.data(), 1, count, target_file_) != count) {
+            return false;
+        }
+        length -= count;
+        copied_length_ += count;
+    }
+    return true;
+}
+
+#else
+
+GribMessageCopier::GribMessageCopier(const std::string& source_path, const std::string& target_path):
+    source_path_{source_path} {
+    source_fd_ = ::open(source_path.c_str(), O_RDONLY);
+    if (source_fd_ == -1) {
+        throw std::runtime_error(fmt::format("can't open file: {}", source_path));
+    }
+
+    // opening target truncates it, which would destroy source if they are the same file,
+    // including paths through symbolic links or hard links.
+    struct stat source_stat{};
+    struct stat target_stat{};
+    if (::fstat(source_fd_, &source_stat) == 0 && ::stat(target_path.c_str(), &target_stat) == 0 &&
+        source_stat.st_dev == target_stat.st_dev && source_stat.st_ino == target_stat.st_ino) {
+        ::close(source_fd_);
+        throw std::runtime_error(fmt::format("target is the same file as source: {}", target_path));
+    }
+
+    target_fd_ = ::open(target_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (target_fd_ == -1) {
+        ::close(source_fd_);
+        throw std::runtime_error(fmt::format("can't open file: {}", target_path));
+    }
+}
+
+GribMessageCopier::~GribMessageCopier() {
+    ::close(source_fd_);
+    ::close(target_fd_);
+}
+
+bool GribMessageCopier::copyMessage(uint64_t offset, uint64_t length) {
+#ifdef __linux__
+    // copy_file_range and sendfile may copy fewer bytes than requested, so call them until all bytes are copied.
+    auto source_offset = static_cast<off_t>(offset);
+    auto use_sendfile = false;
+    while (length > 0) {
+        ssize_t count = -1;
+        if (!use_sendfile) {
+            count = ::copy_file_range(source_fd_, &source_offset, target_fd_, nullptr, length, 0);
+            if (count == -1) {
+                // not supported between these files, such as across file systems before Linux 5.3.
+                use_sendfile = true;
+                continue;
+            }
+        } else {
+            count = ::sendfile(target_fd_, source_fd_, &source_offset, length);
+            if (count == -1) {
+                return copyBuffered(source_offset, length);
+            }
+        }
+
+        // source file is shorter than expected.
+        if (count == 0) {
+            return false;
+        }
+        length -= count;
+        copied_length_ += count;
+    }
+    return true;
+#else
+    return copyBuffered(offset, length);
+#endif
+}
+
+bool GribMessageCopier::copyBuffered(uint64_t offset, uint64_t length) {
+    std::vector<std::byte> buffer(std::min(length, copy_buffer_length));
+    while (length > 0) {
+        const auto count = ::pread(source_fd_, buffer.data(), std::min<uint64_t>(length, buffer.size()), offset);
+        if (count <= 0) {
+            return false;
+        }
+        if (::write(target_fd_, buffer.data(), count) != count) {
+            return false;
+        }
+        offset += count;
+        length -= count;
+        copied_length_ += count;
+    }
+    return true;
+}
+
+#endif
+
+bool GribMessageCopier::copyMessages(const std::vector<GribMessageLocation>& locations) {
+    for (const auto& location : locations) {
+        if (!copyMessage(location.offset, location.length)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t GribMessageCopier::copyMatchingMessages(
+    const std::vector<std::tuple<std::string, std::string>>& conditions) {
+    auto f = std::fopen(source_path_.c_str(), "rb");
+    if (f == nullptr) {
+        throw std::runtime_error(fmt::format("can't open file: {}", source_path_));
+    }
+
+    std::vector<GribMessageLocation> locations;
+    GribFileHandler handler(f, true);
+    auto message_handler = handler.next();
+    while (message_handler) {
+        if (match_conditions(*message_handler, conditions)) {
+            GribMessageLocation location;
+            location.offset = message_handler->getLong("offset");
+            location.length = message_handler->getLong("totalLength");
+            location.discipline = message_handler->getLong("discipline");
+            locations.push_back(location);
+        }
+        message_handler = handler.next(std::move(message_handler));
+    }
+
+    std::fclose(f);
+
+    if (!copyMessages(locations)) {
+        throw std::runtime_error(fmt::format("copy messages failed: {}", source_path_));
+    }
+    return locations.size();
+}
+
+} // namespace grib_coder
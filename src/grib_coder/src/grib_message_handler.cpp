@@ -8,16 +8,52 @@
 #include <grib_coder/sections/grib_section_6.h>
 #include <grib_coder/sections/grib_section_7.h>
 #include <grib_coder/sections/grib_section_8.h>
+#include <grib_coder/grib_mapped_file.h>
 
 #include <grib_property/number_convert.h>
 #include <grib_property/grib_table_database.h>
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
 #include <stdexcept>
+#include <tuple>
+
+#include <sys/stat.h>
 
 namespace grib_coder {
 
+namespace {
+
+// bytes read at first in header only mode, which usually cover all sections before section 7.
+const size_t header_buffer_length = 4096;
+
+const KeyId values_key{"values"};
+
+// size of a regular file, used to check total length of message before reading it.
+// return max value for other files such as pipes, whose size is unknown.
+uint64_t get_file_size(std::FILE* file) {
+    struct stat file_stat{};
+    if (::fstat(fileno(file), &file_stat) != 0 || !S_ISREG(file_stat.st_mode)) {
+        return std::numeric_limits<uint64_t>::max();
+    }
+    return static_cast<uint64_t>(file_stat.st_size);
+}
+
+// check identifier and edition in the first 16 bytes of section 0 before trusting total length,
+// which should be in [20, available_length].
+bool check_section_0(const std::byte* section_0, uint64_t available_length, uint64_t& total_length) {
+    if (std::memcmp(section_0, "GRIB", 4) != 0 || convert_bytes_to_number<uint8_t>(section_0 + 7) != 2) {
+        return false;
+    }
+    total_length = convert_bytes_to_number<uint64_t>(section_0 + 8);
+    return total_length >= 20 && total_length <= available_length;
+}
+
+} // namespace
+
 GribMessageHandler::GribMessageHandler(std::shared_ptr<GribTableDatabase>& db, bool header_only):
     header_only_{header_only},
     table_database_{db} {
@@ -34,41 +70,76 @@ void GribMessageHandler::setCount(long count) {
 bool GribMessageHandler::parseFile(std::FILE* file) {
     const auto start_pos = std::ftell(file);
     offset_ = start_pos;
-    auto section_0 = std::make_shared<GribSection0>();
-    auto result = section_0->parseFile(file);
-    if (!result) {
+    recycleSections();
+    mapped_file_.reset();
+
+    buffer_.clear();
+    if (!readFileBuffer(file, 16)) {
         return false;
     }
-    section_list_.push_back(section_0);
-
-    auto current_pos = std::ftell(file);
-
-    // check file end
-    const auto section8_start_pos = start_pos + section_0->getProperty("totalLength")->getLong() - 4;
 
-    while (current_pos < section8_start_pos) {
-        parseNextSection(file);
-        current_pos = std::ftell(file);
+    // check section 0 before trusting total length, which is used to allocate buffer.
+    const auto file_size = get_file_size(file);
+    if (start_pos < 0 || static_cast<uint64_t>(start_pos) > file_size) {
+        return false;
     }
-
-    if (current_pos != section8_start_pos) {
+    uint64_t total_length = 0;
+    if (!check_section_0(buffer_.data(), file_size - static_cast<uint64_t>(start_pos), total_length)) {
         return false;
     }
 
-    auto section_8 = std::make_shared<GribSection8>();
-    result = section_8->parseFile(file);
+    if (header_only_) {
+        return parseFileHeaders(file, total_length);
+    }
 
-    if (!result) {
+    // read the whole message once and parse all sections from memory.
+    if (!readFileBuffer(file, total_length)) {
         return false;
     }
+    return parseBytes(buffer_);
+}
 
-    section_list_.push_back(section_8);
+bool GribMessageHandler::parseBuffer(const std::byte* data, size_t length) {
+    offset_ = 0;
+    recycleSections();
+    mapped_file_.reset();
+    buffer_.assign(data, data + length);
+    return parseBytes(buffer_);
+}
 
-    return true;
+bool GribMessageHandler::parseBuffer(std::vector<std::byte>&& buffer) {
+    offset_ = 0;
+    recycleSections();
+    mapped_file_.reset();
+    buffer_ = std::move(buffer);
+    return parseBytes(buffer_);
+}
+
+bool GribMessageHandler::parseMappedFile(const std::shared_ptr<GribMappedFile>& mapped_file, uint64_t offset) {
+    offset_ = offset;
+    recycleSections();
+    mapped_file_ = mapped_file;
+
+    // same checks of section 0 as parseFile.
+    if (offset > mapped_file->size() || mapped_file->size() - offset < 16) {
+        return false;
+    }
+    const auto bytes = mapped_file->bytes(offset, mapped_file->size() - offset);
+    uint64_t total_length = 0;
+    if (!check_section_0(bytes.data(), bytes.size(), total_length)) {
+        return false;
+    }
+    return parseBytes(bytes);
 }
 
 bool GribMessageHandler::decodeValues() {
     for (auto& section : section_list_) {
+        if (section->getSectionNumber() == 6) {
+            auto section6 = std::static_pointer_cast<GribSection6>(section);
+            if (!section6->decodeValues(this)) {
+                return false;
+            }
+        }
         if (section->getSectionNumber() == 7) {
             auto section7 = std::static_pointer_cast<GribSection7>(section);
             if (!section7->decodeValues(this)) {
@@ -79,6 +150,58 @@ bool GribMessageHandler::decodeValues() {
     return true;
 }
 
+bool GribMessageHandler::decodeValues(gsl::span<double> values) {
+    return decodeValuesInto(values);
+}
+
+bool GribMessageHandler::decodeValues(gsl::span<float> values) {
+    return decodeValuesInto(values);
+}
+
+template <typename T>
+bool GribMessageHandler::decodeValuesInto(gsl::span<T> values) {
+    // bitmap in section 6 is used by section 7.
+    for (auto& section : section_list_) {
+        if (section->getSectionNumber() == 6) {
+            auto section6 = std::static_pointer_cast<GribSection6>(section);
+            if (!section6->decodeValues(this)) {
+                return false;
+            }
+        }
+        if (section->getSectionNumber() == 7) {
+            auto section7 = std::static_pointer_cast<GribSection7>(section);
+            return section7->decodeValues(this, values);
+        }
+    }
+    return false;
+}
+
+bool GribMessageHandler::getValues(gsl::span<double> values) {
+    const auto data_values = getDataValuesProperty();
+    return data_values != nullptr && data_values->getValues(values);
+}
+
+bool GribMessageHandler::getValues(gsl::span<float> values) {
+    const auto data_values = getDataValuesProperty();
+    return data_values != nullptr && data_values->getValues(values);
+}
+
+void GribMessageHandler::releaseRawValues() {
+    for (auto& section : section_list_) {
+        if (section->getSectionNumber() == 7) {
+            std::static_pointer_cast<GribSection7>(section)->releaseRawValues();
+        }
+    }
+}
+
+gsl::span<const double> GribMessageHandler::getValuesView() {
+    const auto data_values = getDataValuesProperty();
+    if (data_values == nullptr) {
+        return {};
+    }
+    return data_values->getValues();
+}
+
 void GribMessageHandler::setLong(const std::string& key, long value) {
     auto property = getProperty(key);
     if (property == nullptr) {
@@ -116,13 +239,7 @@ void GribMessageHandler::setString(const std::string& key, const std::string& va
     if (property == nullptr) {
         throw std::runtime_error("key is not found");
     }
-    auto code_table_property = dynamic_cast<CodeTableProperty*>(property);
-    if (code_table_property) {
-        // set grib2 table database
-        const auto table_version = getLong("tablesVersion");
-        code_table_property->setTableDatabase(table_database_);
-        code_table_property->setTablesVersion(fmt::format("{}", table_version));
-    }
+    prepareCodeTableProperty(property);
     property->setString(value);
 }
 
@@ -131,13 +248,7 @@ std::string GribMessageHandler::getString(const std::string& key) {
     if (property == nullptr) {
         throw std::runtime_error("key is not found");
     }
-    auto code_table_property = dynamic_cast<CodeTableProperty*>(property);
-    if (code_table_property) {
-        // set grib2 table database
-        const auto table_version = getLong("tablesVersion");
-        code_table_property->setTableDatabase(table_database_);
-        code_table_property->setTablesVersion(fmt::format("{}", table_version));
-    }
+    prepareCodeTableProperty(property);
     return property->getString();
 }
 
@@ -146,6 +257,140 @@ bool GribMessageHandler::hasProperty(const std::string& key) {
     return property != nullptr;
 }
 
+void GribMessageHandler::setDoubleArray(const std::string& key, std::vector<double>& values) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    property->setDoubleArray(values);
+}
+
+std::vector<double> GribMessageHandler::getDoubleArray(const std::string& key) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    return property->getDoubleArray();
+}
+
+void GribMessageHandler::setLong(KeyId key, long value) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    property->setLong(value);
+}
+
+long GribMessageHandler::getLong(KeyId key) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    return property->getLong();
+}
+
+void GribMessageHandler::setDouble(KeyId key, double value) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    property->setDouble(value);
+}
+
+double GribMessageHandler::getDouble(KeyId key) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    return property->getDouble();
+}
+
+void GribMessageHandler::setString(KeyId key, const std::string& value) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    prepareCodeTableProperty(property);
+    property->setString(value);
+}
+
+std::string GribMessageHandler::getString(KeyId key) {
+    auto property = getProperty(key);
+    if (property == nullptr) {
+        throw std::runtime_error("key is not found");
+    }
+    prepareCodeTableProperty(property);
+    return property->getString();
+}
+
+bool GribMessageHandler::hasProperty(KeyId key) {
+    const auto property = getProperty(key);
+    return property != nullptr;
+}
+
+GribProperty* GribMessageHandler::getProperty(KeyId key) {
+    // properties may be changed while parsing.
+    if (!property_table_ready_) {
+        return getProperty(key.getName());
+    }
+
+    const auto index = key.getIndex();
+    if (index >= resolved_properties_.size()) {
+        if (!key.isValid()) {
+            return nullptr;
+        }
+        resolved_properties_.resize(index + 1);
+    }
+
+    auto& resolved_property = resolved_properties_[index];
+    if (!resolved_property.resolved) {
+        resolved_property.property = property_table_.find(key.getName(), key.getHash());
+        resolved_property.resolved = true;
+    }
+    return resolved_property.property;
+}
+
+void GribMessageHandler::buildPropertyTable() {
+    auto changed = property_table_versions_.size() != section_list_.size();
+    for (size_t i = 0; !changed && i < section_list_.size(); i++) {
+        changed = property_table_versions_[i] != section_list_[i]->getPropertyVersion();
+    }
+
+    if (changed) {
+        property_table_versions_.clear();
+        property_table_.clear();
+
+        // same order as looking up properties one by one: handler first, then sections in order.
+        for (const auto& item : property_map_) {
+            property_table_.add(item.first, item.second);
+        }
+        for (const auto& section : section_list_) {
+            section->addPropertiesToTable(property_table_);
+            property_table_versions_.push_back(section->getPropertyVersion());
+        }
+
+        std::fill(std::begin(resolved_properties_), std::end(resolved_properties_), ResolvedProperty{});
+    }
+
+    property_table_ready_ = true;
+}
+
+DataValuesProperty* GribMessageHandler::getDataValuesProperty() {
+    return dynamic_cast<DataValuesProperty*>(getProperty(values_key));
+}
+
+void GribMessageHandler::prepareCodeTableProperty(GribProperty* property) {
+    static const KeyId tables_version_key{"tablesVersion"};
+
+    auto code_table_property = dynamic_cast<CodeTableProperty*>(property);
+    if (code_table_property) {
+        // set grib2 table database
+        const auto table_version = getLong(tables_version_key);
+        code_table_property->setTableDatabase(table_database_);
+        code_table_property->setTablesVersion(fmt::format("{}", table_version));
+    }
+}
+
 
 void GribMessageHandler::dump(const DumpConfig& dump_config) {
     for (const auto& section : section_list_) {
@@ -189,44 +434,191 @@ long GribMessageHandler::calculateTotalLength() const {
     return total_length;
 }
 
-bool GribMessageHandler::parseNextSection(std::FILE* file) {
-    std::byte buffer[5];
-    const auto result = std::fread(buffer, 1, 5, file);
-    if (result != 5) {
+bool GribMessageHandler::parseBytes(gsl::span<const std::byte> bytes) {
+    auto section_0 = nextSection(0, 16);
+    auto result = section_0->parseBytes(bytes, header_only_);
+    if (!result) {
+        return false;
+    }
+
+    const auto total_length = static_cast<size_t>(section_0->getProperty("totalLength")->getLong());
+    if (total_length > static_cast<size_t>(bytes.size()) || total_length < 20) {
+        return false;
+    }
+
+    const auto section8_start_pos = total_length - 4;
+    size_t current_pos = 16;
+
+    while (current_pos < section8_start_pos) {
+        if (section8_start_pos - current_pos < 5) {
+            return false;
+        }
+        const auto section_length = convert_bytes_to_number<uint32_t>(bytes.data() + current_pos);
+        if (section_length < 5 || section_length > section8_start_pos - current_pos) {
+            return false;
+        }
+        if (!parseNextSection(bytes.subspan(current_pos, section_length))) {
+            return false;
+        }
+        current_pos += section_length;
+    }
+
+    auto section_8 = nextSection(8, 4);
+    result = section_8->parseBytes(bytes.subspan(section8_start_pos, 4), header_only_);
+    if (!result) {
+        return false;
+    }
+
+    buildPropertyTable();
+    return true;
+}
+
+bool GribMessageHandler::parseFileHeaders(std::FILE* file, uint64_t total_length) {
+    const auto start_pos = static_cast<long>(offset_.getLong());
+    const auto section8_start_pos = total_length - 4;
+
+    // read leading bytes of message, and read more only when a section before section 7 goes beyond them.
+    // sections keep views into buffer, so all bytes are read before parsing.
+    if (!readFileBuffer(file, std::min<uint64_t>(total_length, header_buffer_length))) {
+        return false;
+    }
+
+    section_headers_.clear();
+    size_t current_pos = 16;
+    while (current_pos < section8_start_pos) {
+        if (section8_start_pos - current_pos < 5 || !readFileBuffer(file, current_pos + 5)) {
+            return false;
+        }
+        const auto section_length = convert_bytes_to_number<uint32_t>(buffer_.data() + current_pos);
+        const auto section_number = convert_bytes_to_number<uint8_t>(buffer_.data() + current_pos + 4);
+        if (section_length < 5 || section_length > section8_start_pos - current_pos) {
+            return false;
+        }
+        if (section_number != 7 && !readFileBuffer(file, current_pos + section_length)) {
+            return false;
+        }
+        section_headers_.emplace_back(current_pos, section_length, section_number);
+        current_pos += section_length;
+    }
+
+    const gsl::span<const std::byte> bytes{buffer_};
+
+    auto section_0 = nextSection(0, 16);
+    if (!section_0->parseBytes(bytes, header_only_)) {
         return false;
     }
-    const auto section_length = convert_bytes_to_number<uint32_t>(buffer);
-    const auto section_number = convert_bytes_to_number<uint8_t>(&buffer[4]);
 
+    for (const auto& [section_pos, section_length, section_number] : section_headers_) {
+        if (section_number != 7) {
+            if (!parseNextSection(bytes.subspan(section_pos, section_length))) {
+                return false;
+            }
+            continue;
+        }
+
+        // section 7 only records where data values are in file.
+        auto section = nextSection(section_number, section_length);
+        std::fseek(file, start_pos + section_pos + 5, SEEK_SET);
+        if (!section->parseFile(file, header_only_) || !decodeSection(section)) {
+            return false;
+        }
+    }
+
+    auto section_8 = nextSection(8, 4);
+    bool result = false;
+    if (buffer_.size() >= total_length) {
+        result = section_8->parseBytes(bytes.subspan(section8_start_pos, 4), header_only_);
+    } else {
+        std::fseek(file, start_pos + section8_start_pos, SEEK_SET);
+        result = section_8->parseFile(file, header_only_);
+    }
+    if (!result) {
+        return false;
+    }
+
+    std::fseek(file, start_pos + total_length, SEEK_SET);
+    buildPropertyTable();
+    return true;
+}
+
+bool GribMessageHandler::readFileBuffer(std::FILE* file, size_t length) {
+    const auto buffer_length = buffer_.size();
+    if (length <= buffer_length) {
+        return true;
+    }
+    buffer_.resize(length);
+    const auto read_count = std::fread(buffer_.data() + buffer_length, 1, length - buffer_length, file);
+    return read_count == length - buffer_length;
+}
+
+bool GribMessageHandler::parseNextSection(gsl::span<const std::byte> bytes) {
+    const auto section_length = convert_bytes_to_number<uint32_t>(bytes.data());
+    const auto section_number = convert_bytes_to_number<uint8_t>(bytes.data() + 4);
+
+    auto section = nextSection(section_number, section_length);
+
+    const auto flag = section->parseBytes(bytes, header_only_);
+    if (!flag) {
+        return false;
+    }
+
+    return decodeSection(section);
+}
+
+void GribMessageHandler::recycleSections() {
+    // swap to keep capacity of both lists.
+    recycled_sections_.swap(section_list_);
+    section_list_.clear();
+    property_table_ready_ = false;
+}
+
+std::shared_ptr<GribSection> GribMessageHandler::nextSection(int section_number, long section_length) {
+    const auto section_index = section_list_.size();
     std::shared_ptr<GribSection> section;
+    if (section_index < recycled_sections_.size()) {
+        auto& recycled_section = recycled_sections_[section_index];
+        if (recycled_section && recycled_section->getSectionNumber() == section_number
+            && recycled_section->resetSection(section_length)) {
+            section = std::move(recycled_section);
+        }
+    }
+
+    if (!section) {
+        section = createSection(section_number, section_length);
+    }
+
+    section_list_.push_back(section);
+    return section;
+}
 
-    if (section_number == 1) {
-        section = std::make_shared<GribSection1>(section_length);
+std::shared_ptr<GribSection> GribMessageHandler::createSection(int section_number, long section_length) {
+    if (section_number == 0) {
+        return std::make_shared<GribSection0>();
+    } else if (section_number == 1) {
+        return std::make_shared<GribSection1>(section_length);
     } else if (section_number == 2) {
         throw std::runtime_error("section 2 is not supported");
     } else if (section_number == 3) {
-        section = std::make_shared<GribSection3>(section_length);
+        return std::make_shared<GribSection3>(section_length);
     } else if (section_number == 4) {
-        section = std::make_shared<GribSection4>(section_length);
+        return std::make_shared<GribSection4>(section_length);
     } else if (section_number == 5) {
-        section = std::make_shared<GribSection5>(section_length);
+        return std::make_shared<GribSection5>(section_length);
     } else if (section_number == 6) {
-        section = std::make_shared<GribSection6>(section_length);
+        return std::make_shared<GribSection6>(section_length);
     } else if (section_number == 7) {
-        section = std::make_shared<GribSection7>(section_length);
+        return std::make_shared<GribSection7>(section_length);
+    } else if (section_number == 8) {
+        return std::make_shared<GribSection8>();
     } else {
         throw std::runtime_error(fmt::format("section number is not supported:{}", section_number));
     }
+}
 
-    // NOTE: where to put this line
-    section_list_.push_back(section);
-
-    auto flag = section->parseFile(file, header_only_);
-    if (!flag) {
-        return false;
-    }
+bool GribMessageHandler::decodeSection(const std::shared_ptr<GribSection>& section) {
+    const auto section_number = section->getSectionNumber();
 
-    flag = section->decode(this);
+    auto flag = section->decode(this);
     if (!flag) {
         return false;
     }
@@ -260,6 +652,10 @@ auto GribMessageHandler::getSection(int section_number, size_t begin_pos) {
 }
 
 GribProperty* GribMessageHandler::getProperty(const std::string& name) {
+    if (property_table_ready_) {
+        return property_table_.find(name);
+    }
+
     for (auto& item : property_map_) {
         if (std::get<0>(item) == name) {
             return std::get<1>(item);
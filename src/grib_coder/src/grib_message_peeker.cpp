@@ -0,0 +1,205 @@
+#include <grib_coder/grib_message_peeker.h>
+#include <grib_coder/sections/grib_section_0.h>
+#include <grib_coder/sections/grib_section_1.h>
+#include <grib_coder/sections/grib_section_3.h>
+#include <grib_coder/sections/grib_section_4.h>
+#include <grib_coder/sections/grib_section_5.h>
+#include <grib_coder/sections/grib_section_6.h>
+#include <grib_coder/templates/template_4_0.h>
+#include <grib_coder/templates/template_4_1.h>
+#include <grib_coder/templates/template_4_8.h>
+#include <grib_coder/templates/template_4_11.h>
+#include <grib_property/number_convert.h>
+
+#include <cstring>
+
+namespace grib_coder {
+
+namespace {
+
+// layouts of section 3 and 5 describe only these templates after template number.
+const size_t grid_definition_template_octet = 14;
+const long grid_definition_template_number = 0;
+const size_t data_representation_template_octet = 11;
+const long data_representation_template_number = 40;
+
+// template 5.0 has the same fields as template 5.40 before its end at octet 21.
+const long simple_packing_template_number = 0;
+
+gsl::span<const OctetFieldInfo> get_product_definition_template_fields(long template_number) {
+    switch (template_number) {
+        case 0:
+            return Template_4_0::getOctetFields();
+        case 1:
+            return Template_4_1::getOctetFields();
+        case 8:
+            return Template_4_8::getOctetFields();
+        case 11:
+            return Template_4_11::getOctetFields();
+        default:
+            return {};
+    }
+}
+
+long read_integer(const std::byte* bytes, size_t length, OctetValueType value_type) {
+    const auto is_signed = value_type == OctetValueType::Signed;
+    switch (length) {
+        case 1:
+            return is_signed ? convert_bytes_to_number<int8_t>(bytes) : convert_bytes_to_number<uint8_t>(bytes);
+        case 2:
+            return is_signed ? convert_bytes_to_number<int16_t>(bytes) : convert_bytes_to_number<uint16_t>(bytes);
+        case 4:
+            return is_signed ? convert_bytes_to_number<int32_t>(bytes) : convert_bytes_to_number<uint32_t>(bytes);
+        default:
+            return static_cast<long>(convert_bytes_to_number<uint64_t>(bytes));
+    }
+}
+
+} // namespace
+
+GribMessagePeeker::GribMessagePeeker(gsl::span<const std::byte> message_bytes):
+    bytes_{message_bytes} {
+    if (bytes_.size() < 16 || std::memcmp(bytes_.data(), "GRIB", 4) != 0) {
+        return;
+    }
+    valid_ = true;
+    section_offsets_[0] = 0;
+    section_lengths_[0] = 16;
+    findSections();
+}
+
+std::optional<GribKeyLocation> GribMessagePeeker::findKey(const std::string& key) const {
+    if (!valid_) {
+        return std::nullopt;
+    }
+
+    if (auto location = findKeyInFields(key, 0, GribSection0::getOctetFields())) {
+        return location;
+    }
+    if (auto location = findKeyInFields(key, 1, GribSection1::getOctetFields())) {
+        return location;
+    }
+    if (auto location = findKeyInFields(
+            key, 3, GribSection3::getOctetFields(),
+            grid_definition_template_octet, grid_definition_template_number)) {
+        return location;
+    }
+    if (auto location = findKeyInFields(key, 4, GribSection4::getOctetFields())) {
+        return location;
+    }
+    if (section_lengths_[4] > 0) {
+        const auto template_number = readTemplateNumber(4, 8);
+        if (auto location = findKeyInFields(
+                key, 4, get_product_definition_template_fields(template_number), 9, template_number)) {
+            return location;
+        }
+    }
+    if (section_lengths_[5] > 0) {
+        auto template_number = data_representation_template_number;
+        if (readTemplateNumber(5, data_representation_template_octet - 1) == simple_packing_template_number) {
+            template_number = simple_packing_template_number;
+        }
+        if (auto location = findKeyInFields(
+                key, 5, GribSection5::getOctetFields(), data_representation_template_octet, template_number)) {
+            return location;
+        }
+    }
+    return findKeyInFields(key, 6, GribSection6::getOctetFields());
+}
+
+std::optional<long> GribMessagePeeker::getLong(const std::string& key) const {
+    const auto location = findKey(key);
+    if (!location
+        || (location->value_type != OctetValueType::Unsigned && location->value_type != OctetValueType::Signed)) {
+        return std::nullopt;
+    }
+    return read_integer(bytes_.data() + location->offset, location->length, location->value_type);
+}
+
+std::optional<double> GribMessagePeeker::getDouble(const std::string& key) const {
+    const auto location = findKey(key);
+    if (!location || location->value_type == OctetValueType::String) {
+        return std::nullopt;
+    }
+    const auto bytes = bytes_.data() + location->offset;
+    if (location->value_type == OctetValueType::Float) {
+        return convert_bytes_to_number<float>(bytes);
+    }
+    return static_cast<double>(read_integer(bytes, location->length, location->value_type));
+}
+
+std::optional<std::string> GribMessagePeeker::getString(const std::string& key) const {
+    const auto location = findKey(key);
+    if (!location || location->value_type != OctetValueType::String) {
+        return std::nullopt;
+    }
+    return std::string(reinterpret_cast<const char*>(bytes_.data() + location->offset), location->length);
+}
+
+void GribMessagePeeker::findSections() {
+    uint64_t offset = 16;
+    while (offset + 5 <= bytes_.size()) {
+        if (std::memcmp(bytes_.data() + offset, "7777", 4) == 0) {
+            break;
+        }
+        const auto section_length = convert_bytes_to_number<uint32_t>(bytes_.data() + offset);
+        const auto section_number = convert_bytes_to_number<uint8_t>(bytes_.data() + offset + 4);
+        if (section_length < 5 || section_number < 1 || section_number > 7) {
+            break;
+        }
+
+        // only fields before section 7 are read, so section 7 may be truncated.
+        if (section_number != 7 && offset + section_length > bytes_.size()) {
+            break;
+        }
+
+        if (section_lengths_[section_number] == 0) {
+            section_offsets_[section_number] = offset;
+            section_lengths_[section_number] = section_length;
+        }
+        if (section_number == 7) {
+            break;
+        }
+        offset += section_length;
+    }
+}
+
+std::optional<GribKeyLocation> GribMessagePeeker::findKeyInFields(
+    const std::string& key, int section_number, gsl::span<const OctetFieldInfo> fields,
+    size_t template_octet, long template_number) const {
+    const auto section_length = section_lengths_[section_number];
+    if (section_length == 0) {
+        return std::nullopt;
+    }
+
+    for (const auto& field : fields) {
+        if (std::strcmp(field.name, key.c_str()) != 0) {
+            continue;
+        }
+        if (field.octet + field.length - 1 > section_length) {
+            return std::nullopt;
+        }
+        if (template_octet > 0 && field.octet > template_octet
+            && readTemplateNumber(section_number, template_octet - 1) != template_number) {
+            return std::nullopt;
+        }
+
+        GribKeyLocation location;
+        location.section_number = section_number;
+        location.template_number = field.octet > template_octet ? template_number : -1;
+        location.offset = section_offsets_[section_number] + field.octet - 1;
+        location.length = field.length;
+        location.value_type = field.value_type;
+        return location;
+    }
+    return std::nullopt;
+}
+
+long GribMessagePeeker::readTemplateNumber(int section_number, size_t octet) const {
+    if (section_lengths_[section_number] < octet + 1) {
+        return -1;
+    }
+    return convert_bytes_to_number<uint16_t>(bytes_.data() + section_offsets_[section_number] + octet - 1);
+}
+
+} // namespace grib_coder
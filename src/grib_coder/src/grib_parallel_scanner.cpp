@@ -0,0 +1,144 @@
+#include <grib_coder/grib_parallel_scanner.h>
+#include <grib_coder/grib_mapped_file.h>
+
+#include <grib_property/number_convert.h>
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <unordered_map>
+
+namespace grib_coder {
+
+namespace {
+// don't split file into ranges smaller than this.
+const uint64_t min_range_length = 1 << 20;
+}
+
+GribParallelScanner::GribParallelScanner(std::shared_ptr<GribMappedFile> mapped_file, size_t thread_count):
+    mapped_file_{std::move(mapped_file)},
+    thread_count_{thread_count} {
+    if (thread_count_ == 0) {
+        thread_count_ = std::max(1u, std::thread::hardware_concurrency());
+    }
+}
+
+std::vector<GribMessageLocation> GribParallelScanner::scan() {
+    const auto file_size = mapped_file_->size();
+
+    auto range_count = std::min<uint64_t>(thread_count_, file_size / min_range_length);
+    range_count = std::max<uint64_t>(range_count, 1);
+    const auto range_length = file_size / range_count;
+
+    std::vector<std::future<std::vector<GribMessageLocation>>> futures;
+    for (uint64_t i = 0; i < range_count; i++) {
+        const auto begin = i * range_length;
+        const auto end = (i == range_count - 1) ? file_size : begin + range_length;
+        futures.push_back(std::async(std::launch::async, [this, begin, end]() {
+            return this->scanRange(begin, end);
+        }));
+    }
+
+    std::unordered_map<uint64_t, GribMessageLocation> found_locations;
+    for (auto& future : futures) {
+        for (const auto& location : future.get()) {
+            found_locations[location.offset] = location;
+        }
+    }
+
+    // walk from the beginning of file like a serial pass. Ranges which resynchronised on a wrong
+    // identifier are not used, and missed messages are checked here.
+    std::vector<GribMessageLocation> locations;
+    uint64_t offset = 0;
+    while (offset < file_size) {
+        std::optional<GribMessageLocation> location;
+        const auto iter = found_locations.find(offset);
+        if (iter != std::end(found_locations)) {
+            location = iter->second;
+        } else {
+            location = checkMessage(offset);
+        }
+        if (!location) {
+            break;
+        }
+        locations.push_back(*location);
+        offset += location->length;
+    }
+
+    return locations;
+}
+
+std::vector<GribMessageLocation> GribParallelScanner::scanRange(uint64_t begin, uint64_t end) const {
+    std::vector<GribMessageLocation> locations;
+    auto offset = begin;
+    while (offset < end) {
+        offset = findIdentifier(offset, end);
+        if (offset >= end) {
+            break;
+        }
+
+        auto location = checkMessage(offset);
+        if (!location) {
+            offset += 1;
+            continue;
+        }
+
+        while (location && offset < end) {
+            locations.push_back(*location);
+            offset += location->length;
+            location = checkMessage(offset);
+        }
+    }
+    return locations;
+}
+
+std::optional<GribMessageLocation> GribParallelScanner::checkMessage(uint64_t offset) const {
+    const auto section_0 = mapped_file_->bytes(offset, 16);
+    if (section_0.size() < 16) {
+        return std::nullopt;
+    }
+
+    const auto bytes = section_0.data();
+    if (std::memcmp(bytes, "GRIB", 4) != 0 || convert_bytes_to_number<uint8_t>(bytes + 7) != 2) {
+        return std::nullopt;
+    }
+
+    GribMessageLocation location;
+    location.offset = offset;
+    location.length = convert_bytes_to_number<uint64_t>(bytes + 8);
+    location.discipline = convert_bytes_to_number<uint8_t>(bytes + 6);
+
+    // section 0 and section 8
+    if (location.length < 20 || location.length > mapped_file_->size() - offset) {
+        return std::nullopt;
+    }
+
+    if (std::memcmp(mapped_file_->data() + offset + location.length - 4, "7777", 4) != 0) {
+        return std::nullopt;
+    }
+
+    return location;
+}
+
+uint64_t GribParallelScanner::findIdentifier(uint64_t begin, uint64_t end) const {
+    const auto data = reinterpret_cast<const char*>(mapped_file_->data());
+    const auto file_size = mapped_file_->size();
+    auto offset = begin;
+    while (offset < end) {
+        const auto p = std::memchr(data + offset, 'G', end - offset);
+        if (p == nullptr) {
+            return end;
+        }
+        offset = static_cast<const char*>(p) - data;
+        if (offset + 8 <= file_size
+            && std::memcmp(data + offset, "GRIB", 4) == 0
+            && data[offset + 7] == 2) {
+            return offset;
+        }
+        offset += 1;
+    }
+    return end;
+}
+
+} // namespace grib_coder
@@ -0,0 +1,152 @@
+#include <grib_coder/grib_pipeline_file_handler.h>
+#include <grib_coder/grib_scanner.h>
+#include <grib_property/grib_table_database.h>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace grib_coder {
+
+GribPipelineFileHandler::GribPipelineFileHandler(std::FILE* file, size_t queue_size, DecodeFilter filter):
+    file_{file},
+    queue_size_{queue_size == 0 ? 1 : queue_size},
+    filter_{std::move(filter)} {
+    table_database_ = std::make_shared<GribTableDatabase>();
+
+    const auto worker_count = std::max<size_t>(1, std::min<size_t>(queue_size_, std::thread::hardware_concurrency()));
+    for (size_t i = 0; i < worker_count; i++) {
+        workers_.emplace_back(&GribPipelineFileHandler::runTasks, this);
+    }
+    reader_ = std::thread{&GribPipelineFileHandler::readMessages, this};
+}
+
+GribPipelineFileHandler::~GribPipelineFileHandler() {
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopped_ = true;
+    }
+    queue_not_full_.notify_all();
+    tasks_not_empty_.notify_all();
+    reader_.join();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+
+    // tasks not started are dropped with their futures.
+    tasks_.clear();
+    queue_.clear();
+}
+
+std::unique_ptr<GribMessageHandler> GribPipelineFileHandler::next() {
+    std::unique_lock<std::mutex> lock{mutex_};
+    queue_not_empty_.wait(lock, [this]() {
+        return !queue_.empty() || finished_;
+    });
+    if (queue_.empty()) {
+        return nullptr;
+    }
+
+    auto message_future = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    queue_not_full_.notify_one();
+
+    return message_future.get();
+}
+
+void GribPipelineFileHandler::readMessages() {
+    uint64_t count = 0;
+
+    try {
+        // scanner checks section 0 and bounds total length by file size before bytes are allocated.
+        GribScanner scanner{file_};
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock{mutex_};
+                queue_not_full_.wait(lock, [this]() {
+                    return queue_.size() < queue_size_ || stopped_;
+                });
+                if (stopped_) {
+                    break;
+                }
+            }
+
+            const auto location = scanner.next();
+            if (!location) {
+                break;
+            }
+            std::vector<std::byte> bytes(location->length);
+            std::fseek(file_, location->offset, SEEK_SET);
+            if (std::fread(bytes.data(), 1, bytes.size(), file_) != bytes.size()) {
+                break;
+            }
+
+            count += 1;
+            std::packaged_task<std::unique_ptr<GribMessageHandler>()> task{
+                [this, bytes = std::move(bytes), offset = location->offset, count]() mutable {
+                    return decodeMessage(std::move(bytes), offset, count);
+                }};
+
+            {
+                std::lock_guard<std::mutex> lock{mutex_};
+                queue_.push_back(task.get_future());
+                tasks_.push_back(std::move(task));
+            }
+            tasks_not_empty_.notify_one();
+            queue_not_empty_.notify_one();
+        }
+    } catch (...) {
+        // next() rethrows error after messages read before it.
+        std::promise<std::unique_ptr<GribMessageHandler>> error;
+        error.set_exception(std::current_exception());
+        std::lock_guard<std::mutex> lock{mutex_};
+        queue_.push_back(error.get_future());
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        finished_ = true;
+    }
+    queue_not_empty_.notify_all();
+}
+
+void GribPipelineFileHandler::runTasks() {
+    while (true) {
+        std::packaged_task<std::unique_ptr<GribMessageHandler>()> task;
+        {
+            std::unique_lock<std::mutex> lock{mutex_};
+            tasks_not_empty_.wait(lock, [this]() {
+                return !tasks_.empty() || stopped_;
+            });
+            if (stopped_) {
+                return;
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        // exceptions are stored in future of task.
+        task();
+    }
+}
+
+std::unique_ptr<GribMessageHandler> GribPipelineFileHandler::decodeMessage(
+    std::vector<std::byte> bytes, uint64_t offset, uint64_t count) {
+    // parse header sections first, so that filter can skip decoding values.
+    auto message_handler = std::make_unique<GribMessageHandler>(table_database_, true);
+    if (!message_handler->parseBuffer(std::move(bytes))) {
+        throw std::runtime_error(fmt::format("message can't be parsed at offset {}", offset));
+    }
+    message_handler->setLong("offset", offset);
+    message_handler->setCount(count);
+
+    if (!filter_ || filter_(message_handler.get())) {
+        if (!message_handler->decodeValues()) {
+            throw std::runtime_error(fmt::format("values of message can't be decoded at offset {}", offset));
+        }
+    }
+    return message_handler;
+}
+
+} // namespace grib_coder
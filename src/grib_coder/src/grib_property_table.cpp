@@ -0,0 +1,75 @@
+#include <grib_coder/grib_property_table.h>
+
+#include <algorithm>
+
+namespace grib_coder {
+
+namespace {
+
+const size_t min_slot_count = 256;
+
+} // namespace
+
+void GribPropertyTable::clear() {
+    std::fill(std::begin(slots_), std::end(slots_), Slot{});
+    size_ = 0;
+}
+
+void GribPropertyTable::add(const std::string& name, size_t hash, GribProperty* property) {
+    if ((size_ + 1) * 2 > slots_.size()) {
+        grow();
+    }
+
+    const auto mask = slots_.size() - 1;
+    for (auto index = hash & mask; ; index = (index + 1) & mask) {
+        auto& slot = slots_[index];
+        if (slot.name == nullptr) {
+            slot.hash = hash;
+            slot.name = &name;
+            slot.property = property;
+            size_++;
+            return;
+        }
+        if (slot.hash == hash && *slot.name == name) {
+            return;
+        }
+    }
+}
+
+GribProperty* GribPropertyTable::find(const std::string& name, size_t hash) const {
+    if (slots_.empty()) {
+        return nullptr;
+    }
+
+    const auto mask = slots_.size() - 1;
+    for (auto index = hash & mask; ; index = (index + 1) & mask) {
+        const auto& slot = slots_[index];
+        if (slot.name == nullptr) {
+            return nullptr;
+        }
+        if (slot.hash == hash && *slot.name == name) {
+            return slot.property;
+        }
+    }
+}
+
+void GribPropertyTable::grow() {
+    auto old_slots = std::move(slots_);
+    slots_.assign(std::max(min_slot_count, old_slots.size() * 2), Slot{});
+    size_ = 0;
+
+    const auto mask = slots_.size() - 1;
+    for (const auto& old_slot : old_slots) {
+        if (old_slot.name == nullptr) {
+            continue;
+        }
+        auto index = old_slot.hash & mask;
+        while (slots_[index].name != nullptr) {
+            index = (index + 1) & mask;
+        }
+        slots_[index] = old_slot;
+        size_++;
+    }
+}
+
+} // namespace grib_coder
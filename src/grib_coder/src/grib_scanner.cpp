@@ -0,0 +1,62 @@
+#include <grib_coder/grib_scanner.h>
+
+#include <grib_property/number_convert.h>
+
+#include <cstring>
+
+namespace grib_coder {
+
+GribScanner::GribScanner(std::FILE* file):
+    file_{file} {
+    const auto current_pos = std::ftell(file_);
+    std::fseek(file_, 0, SEEK_END);
+    file_size_ = std::ftell(file_);
+    std::fseek(file_, current_pos, SEEK_SET);
+}
+
+std::optional<GribMessageLocation> GribScanner::next() {
+    const auto start_pos = static_cast<uint64_t>(std::ftell(file_));
+
+    // section 0: identifier(4) reserved(2) discipline(1) editionNumber(1) totalLength(8)
+    std::byte buffer[16];
+    const auto read_count = std::fread(buffer, 1, 16, file_);
+    if (read_count != 16) {
+        return std::nullopt;
+    }
+
+    if (std::memcmp(buffer, "GRIB", 4) != 0 || convert_bytes_to_number<uint8_t>(&buffer[7]) != 2) {
+        return std::nullopt;
+    }
+
+    GribMessageLocation location;
+    location.offset = start_pos;
+    location.length = convert_bytes_to_number<uint64_t>(&buffer[8]);
+    location.discipline = convert_bytes_to_number<uint8_t>(&buffer[6]);
+
+    // same checks as GribParallelScanner, so both scanners find the same messages.
+    // file may grow after scanner is created, and start_pos is beyond the size measured then.
+    if (start_pos > file_size_ || location.length < 20 || location.length > file_size_ - start_pos) {
+        return std::nullopt;
+    }
+
+    // section 8
+    char end_section[4];
+    if (std::fseek(file_, start_pos + location.length - 4, SEEK_SET) != 0
+        || std::fread(end_section, 1, 4, file_) != 4
+        || std::memcmp(end_section, "7777", 4) != 0) {
+        return std::nullopt;
+    }
+    return location;
+}
+
+std::vector<GribMessageLocation> GribScanner::scan() {
+    std::vector<GribMessageLocation> locations;
+    auto location = next();
+    while (location) {
+        locations.push_back(*location);
+        location = next();
+    }
+    return locations;
+}
+
+} // namespace grib_coder
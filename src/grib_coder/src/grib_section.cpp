@@ -1,14 +1,27 @@
 #include <grib_coder/grib_section.h>
 #include <grib_coder/grib_message_handler.h>
 #include <grib_coder/template_component.h>
+#include <grib_coder/grib_property_table.h>
 
 #include <grib_property/property_component.h>
 #include <grib_property/code_table_property.h>
 
+#include <atomic>
 #include <iterator>
 
 namespace grib_coder {
 
+namespace {
+
+// versions are unique among all sections, so a new section never has the version of a released one.
+std::atomic<uint64_t> last_property_version{0};
+
+uint64_t next_property_version() {
+    return ++last_property_version;
+}
+
+} // namespace
+
 GribSection::GribSection(int section_number):
     GribSection{section_number, 0} {
 }
@@ -103,6 +116,20 @@ int GribSection::getSectionNumber() const {
     return static_cast<int>(section_number_);
 }
 
+bool GribSection::resetSection(long section_length) {
+    return section_length == getSectionLength();
+}
+
+bool GribSection::parseFile(std::FILE* file, bool header_only) {
+    const auto buffer_length = section_length_ - 5;
+    buffer_.resize(section_length_);
+    const auto read_count = std::fread(buffer_.data() + 5, 1, buffer_length, file);
+    if (static_cast<long>(read_count) != buffer_length) {
+        return false;
+    }
+    return parseBytes(buffer_, header_only);
+}
+
 bool GribSection::decode(GribMessageHandler* handler) {
     return true;
 }
@@ -116,12 +143,42 @@ GribProperty* GribSection::getProperty(const std::string& name) {
 }
 
 void GribSection::registerProperty(const std::string& name, GribProperty* property) {
-    property_map_[name] = property;
+    const auto item = property_map_.find(name);
+    if (item != std::end(property_map_)) {
+        item->second = property;
+    } else if (!spare_property_nodes_.empty()) {
+        auto node = std::move(spare_property_nodes_.back());
+        spare_property_nodes_.pop_back();
+        node.key() = name;
+        node.mapped() = property;
+        property_map_.insert(std::move(node));
+    } else {
+        property_map_.emplace(name, property);
+    }
+    property_version_ = next_property_version();
 }
 
 void GribSection::unregisterProperty(const std::string& name)
 {
-    property_map_.erase(name);
+    auto node = property_map_.extract(name);
+    if (node) {
+        spare_property_nodes_.push_back(std::move(node));
+    }
+    property_version_ = next_property_version();
+}
+
+void GribSection::addPropertiesToTable(GribPropertyTable& table) {
+    if (hashed_properties_version_ != property_version_ || hashed_properties_.size() != property_map_.size()) {
+        hashed_properties_.clear();
+        for (const auto& item : property_map_) {
+            hashed_properties_.emplace_back(std::hash<std::string>{}(item.first), &item.first, item.second);
+        }
+        hashed_properties_version_ = property_version_;
+    }
+
+    for (const auto& [hash, name, property] : hashed_properties_) {
+        table.add(*name, hash, property);
+    }
 }
 
 void GribSection::dumpSection(GribMessageHandler* message_handler, std::size_t start_octec,
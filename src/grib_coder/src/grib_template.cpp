@@ -13,7 +13,7 @@ GribTemplate::GribTemplate(int template_length):
     template_length_{template_length} {
 }
 
-bool GribTemplate::parse(std::vector<std::byte>::const_iterator& iterator) {
+bool GribTemplate::parse(const std::byte*& iterator) {
     for (auto& component : components_) {
         component->parse(iterator);
     }
@@ -1,4 +1,5 @@
 #include <grib_coder/sections/grib_section_0.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 #include <grib_coder/grib_message_handler.h>
 
@@ -6,6 +7,21 @@
 
 namespace grib_coder {
 
+constexpr auto GribSection0::octetLayout() {
+    return std::make_tuple(
+        octet_field(1, 4, "identifier", &GribSection0::identifier_),
+        octet_field(5, 2, "reserved", &GribSection0::reserved_),
+        octet_field(7, 1, "discipline", &GribSection0::discipline_),
+        octet_field(8, 1, "editionNumber", &GribSection0::edition_number_),
+        octet_field(9, 8, "totalLength", &GribSection0::total_length_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> GribSection0::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 GribSection0::GribSection0():
     GribSection{0, 16} {
     init();
@@ -18,11 +34,16 @@ bool GribSection0::parseFile(std::FILE* file, bool header_only) {
         return false;
     }
 
-    auto iterator = std::cbegin(buffer);
-    for (auto& component : components_) {
-        component->parse(iterator);
+    return parseBytes(buffer, header_only);
+}
+
+bool GribSection0::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (bytes.size() < 16) {
+        return false;
     }
 
+    unpack_octet_fields(*this, bytes.data(), octetLayout());
+
     return true;
 }
 
@@ -32,24 +53,12 @@ bool GribSection0::encode(GribMessageHandler* handler) {
 }
 
 void GribSection0::init() {
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {4, "identifier", &identifier_},
-        {2, "reserved", &reserved_},
-        {1, "discipline", &discipline_},
-        {1, "editionNumber", &edition_number_},
-        {8, "totalLength", &total_length_},
-    };
+    static_assert(is_valid_octet_layout(octetLayout(), 1, 17), "section 0 layout");
 
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-                std::get<0>(item),
-                std::get<1>(item),
-                std::get<2>(item))
-        );
-        registerProperty(
-            std::get<1>(item),
-            std::get<2>(item));
-    }
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+        registerProperty(name, property);
+    });
 
     std::vector<std::tuple<CodeTableProperty*, std::string>> tables_id{
         {&discipline_, "0.0"},
@@ -1,6 +1,7 @@
 #include <grib_coder/sections/grib_section_1.h>
 #include <grib_property/property_component.h>
 #include <grib_coder/grib_message_handler.h>
+#include <grib_coder/octet_layout.h>
 
 #include <gsl/span>
 
@@ -8,6 +9,31 @@
 
 namespace grib_coder {
 
+constexpr auto GribSection1::octetLayout() {
+    return std::make_tuple(
+        octet_field(1, 4, "section1Length", &GribSection1::section_length_),
+        octet_field(5, 1, "numberOfSection", &GribSection1::section_number_),
+        octet_field(6, 2, "centre", &GribSection1::centre_),
+        octet_field(8, 2, "subCentre", &GribSection1::sub_centre_),
+        octet_field(10, 1, "tablesVersion", &GribSection1::tables_version_),
+        octet_field(11, 1, "localTablesVersion", &GribSection1::local_tables_version_),
+        octet_field(12, 1, "significanceOfReferenceTime", &GribSection1::significance_of_reference_time_),
+        octet_field(13, 2, "year", &GribSection1::year_),
+        octet_field(15, 1, "month", &GribSection1::month_),
+        octet_field(16, 1, "day", &GribSection1::day_),
+        octet_field(17, 1, "hour", &GribSection1::hour_),
+        octet_field(18, 1, "minute", &GribSection1::minute_),
+        octet_field(19, 1, "second", &GribSection1::second_),
+        octet_field(20, 1, "productionStatusOfProcessedData", &GribSection1::production_status_of_processed_data_),
+        octet_field(21, 1, "typeOfProcessedData", &GribSection1::type_of_processed_data_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> GribSection1::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 GribSection1::GribSection1() :
     GribSection(1) {
     init();
@@ -19,23 +45,12 @@ GribSection1::GribSection1(long section_length) :
     init();
 }
 
-bool GribSection1::parseFile(std::FILE* file, bool header_only) {
-    const auto buffer_length = section_length_ - 5;
-    std::vector<std::byte> buffer(section_length_);
-    const auto read_count = std::fread(&buffer[5], 1, buffer_length, file);
-    if (static_cast<long>(read_count) != buffer_length) {
+bool GribSection1::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (static_cast<long>(bytes.size()) < section_length_) {
         return false;
     }
 
-    auto iterator = std::cbegin(buffer) + 5;
-
-    auto component_span = gsl::make_span(components_);
-    auto sub_component_span = component_span.subspan(2);
-
-    for (auto& component : sub_component_span) {
-        component->parse(iterator);
-    }
-
+    unpack_octet_fields(*this, bytes.data(), octetLayout());
     return true;
 }
 
@@ -57,31 +72,12 @@ bool GribSection1::decode(GribMessageHandler* container) {
 }
 
 void GribSection1::init() {
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {4, "section1Length", &section_length_},
-        {1, "numberOfSection", &section_number_},
-        {2, "centre", &centre_},
-        {2, "subCentre", &sub_centre_},
-        {1, "tablesVersion", &tables_version_},
-        {1, "localTablesVersion", &local_tables_version_},
-        {1, "significanceOfReferenceTime", &significance_of_reference_time_},
-        {2, "year", &year_},
-        {1, "month", &month_},
-        {1, "day", &day_},
-        {1, "hour", &hour_},
-        {1, "minute", &minute_},
-        {1, "second", &second_},
-        {1, "productionStatusOfProcessedData", &production_status_of_processed_data_},
-        {1, "typeOfProcessedData", &type_of_processed_data_},
-    };
+    static_assert(is_valid_octet_layout(octetLayout(), 1, 22), "section 1 layout");
 
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-            std::get<0>(item),
-            std::get<1>(item),
-            std::get<2>(item)));
-        registerProperty(std::get<1>(item), std::get<2>(item));
-    }
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+        registerProperty(name, property);
+    });
 
     std::vector<std::tuple<CodeTableProperty*, std::string>> tables_id{
         {&tables_version_, "1.0"},
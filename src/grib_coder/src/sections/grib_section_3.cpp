@@ -1,4 +1,5 @@
 #include <grib_coder/sections/grib_section_3.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 
 #include <gsl/span>
@@ -6,6 +7,42 @@
 #include <cassert>
 
 namespace grib_coder {
+constexpr auto GribSection3::octetLayout() {
+    return std::make_tuple(
+        octet_field(1, 4, "section3Length", &GribSection3::section_length_),
+        octet_field(5, 1, "numberOfSection", &GribSection3::section_number_),
+        octet_field(6, 1, "sourceOfGridDefinition", &GribSection3::source_of_grid_definition_),
+        octet_field(7, 4, "numberOfDataPoints", &GribSection3::number_of_data_points_),
+        octet_field(11, 1, "numberOfOctectsForNumberOfPoints", &GribSection3::number_of_octects_for_number_of_points_),
+        octet_field(12, 1, "interpretationOfNumberOfPoints", &GribSection3::interpretation_of_number_of_points_),
+        octet_field(13, 2, "gridDefinitionTemplateNumber", &GribSection3::grid_definition_template_number_),
+        octet_field(15, 1, "shapeOfEarth", &GribSection3::shape_of_earth_),
+        octet_field(16, 1, "scaleFactorOfRadiusOfSphericalEarth", &GribSection3::scale_factor_of_radius_of_spherical_earth_),
+        octet_field(17, 4, "scaledValueOfRadiusOfSphericalEarth", &GribSection3::scaled_value_of_radius_of_spherical_earth_),
+        octet_field(21, 1, "scaleFactorOfEarthMajorAxis", &GribSection3::scale_factor_of_earth_major_axis_),
+        octet_field(22, 4, "scaledValueOfEarthMajorAxis", &GribSection3::scaled_value_of_earth_major_axis_),
+        octet_field(26, 1, "scaleFactorOfEarthMinorAxis", &GribSection3::scale_factor_of_earth_minor_axis_),
+        octet_field(27, 4, "scaledValueOfEarthMinorAxis", &GribSection3::scaled_value_of_earth_minor_axis_),
+        octet_field(31, 4, "ni", &GribSection3::ni_),
+        octet_field(35, 4, "nj", &GribSection3::nj_),
+        octet_field(39, 4, "basicAngleOfTheInitialProductionDomain", &GribSection3::basic_angle_of_the_initial_production_domain_),
+        octet_field(43, 4, "subdivisionsOfBasicAngle", &GribSection3::subdivisions_of_basic_angle_),
+        octet_field(47, 4, "latitudeOfFirstGridPoint", &GribSection3::latitude_of_first_grid_point_),
+        octet_field(51, 4, "longitudeOfFirstGridPoint", &GribSection3::longitude_of_first_grid_point_),
+        octet_field(55, 1, "resolutionAndComponentFlags", &GribSection3::resolution_and_component_flags_),
+        octet_field(56, 4, "latitudeOfLastGridPoint", &GribSection3::latitude_of_last_grid_point_),
+        octet_field(60, 4, "longitudeOfLastGridPoint", &GribSection3::longitude_of_last_grid_point_),
+        octet_field(64, 4, "iDirectionIncrement", &GribSection3::i_direction_increment_),
+        octet_field(68, 4, "jDirectionIncrement", &GribSection3::j_direction_increment_),
+        octet_field(72, 1, "scanningMode", &GribSection3::scanning_mode_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> GribSection3::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 GribSection3::GribSection3():
     GribSection{3} {
     init();
@@ -17,22 +54,12 @@ GribSection3::GribSection3(long section_length):
     init();
 }
 
-bool GribSection3::parseFile(std::FILE* file, bool header_only) {
-    const auto buffer_length = section_length_ - 5;
-    std::vector<std::byte> buffer(section_length_);
-    const auto read_count = std::fread(&buffer[5], 1, buffer_length, file);
-    if (static_cast<long>(read_count) != buffer_length) {
+bool GribSection3::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (static_cast<long>(bytes.size()) < section_length_) {
         return false;
     }
 
-    auto iterator = std::cbegin(buffer) + 5;
-
-    auto component_span = gsl::make_span(components_);
-    auto sub_component_span = component_span.subspan(2);
-
-    for (auto& component : sub_component_span) {
-        component->parse(iterator);
-    }
+    unpack_octet_fields(*this, bytes.data(), octetLayout());
 
     return true;
 }
@@ -45,46 +72,12 @@ bool GribSection3::decode(GribMessageHandler* container) {
 void GribSection3::init() {
     grid_definition_template_number_.setByteCount(2);
 
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {4, "section3Length", &section_length_},
-        {1, "numberOfSection", &section_number_},
-        {1, "sourceOfGridDefinition", &source_of_grid_definition_},
-        {4, "numberOfDataPoints", &number_of_data_points_},
-        {1, "numberOfOctectsForNumberOfPoints", &number_of_octects_for_number_of_points_},
-        {1, "interpretationOfNumberOfPoints", &interpretation_of_number_of_points_},
-        {2, "gridDefinitionTemplateNumber", &grid_definition_template_number_},
-
-        {1, "shapeOfEarth", &shape_of_earth_},
-        {1, "scaleFactorOfRadiusOfSphericalEarth", &scale_factor_of_radius_of_spherical_earth_},
-        {4, "scaledValueOfRadiusOfSphericalEarth", &scaled_value_of_radius_of_spherical_earth_},
-        {1, "scaleFactorOfEarthMajorAxis", &scale_factor_of_earth_major_axis_},
-        {4, "scaledValueOfEarthMajorAxis", &scaled_value_of_earth_major_axis_},
-        {1, "scaleFactorOfEarthMinorAxis", &scale_factor_of_earth_minor_axis_},
-        {4, "scaledValueOfEarthMinorAxis", &scaled_value_of_earth_minor_axis_},
-
-        {4, "ni", &ni_},
-        {4, "nj", &nj_},
-
-        {4, "basicAngleOfTheInitialProductionDomain", &basic_angle_of_the_initial_production_domain_},
-        {4, "subdivisionsOfBasicAngle", &subdivisions_of_basic_angle_},
-
-        {4, "latitudeOfFirstGridPoint", &latitude_of_first_grid_point_},
-        {4, "longitudeOfFirstGridPoint", &longitude_of_first_grid_point_},
-        {1, "resolutionAndComponentFlags", &resolution_and_component_flags_},
-        {4, "latitudeOfLastGridPoint", &latitude_of_last_grid_point_},
-        {4, "longitudeOfLastGridPoint", &longitude_of_last_grid_point_},
-        {4, "iDirectionIncrement", &i_direction_increment_},
-        {4, "jDirectionIncrement", &j_direction_increment_},
-        {1, "scanningMode", &scanning_mode_},
-    };
+    static_assert(is_valid_octet_layout(octetLayout(), 1, 73), "section 3 layout");
 
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-            std::get<0>(item),
-            std::get<1>(item),
-            std::get<2>(item)));
-        registerProperty(std::get<1>(item), std::get<2>(item));
-    }
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+        registerProperty(name, property);
+    });
 
     grid_definition_template_number_.setByteCount(2);
 
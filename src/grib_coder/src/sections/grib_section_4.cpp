@@ -4,14 +4,30 @@
 #include <grib_coder/templates/template_4_8.h>
 #include <grib_coder/templates/template_4_11.h>
 #include <grib_coder/template_component.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 
 #include <gsl/span>
 
+#include <algorithm>
 #include <cassert>
 #include <stdexcept>
 
 namespace grib_coder {
+constexpr auto GribSection4::octetLayout() {
+    return std::make_tuple(
+        octet_field(1, 4, "section4Length", &GribSection4::section_length_),
+        octet_field(5, 1, "numberOfSection", &GribSection4::section_number_),
+        octet_field(6, 2, "nv", &GribSection4::nv_),
+        octet_field(8, 2, "productDefinitionTemplateNumber", &GribSection4::product_definition_template_number_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> GribSection4::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 GribSection4::GribSection4():
     GribSection{4} {
     init();
@@ -23,15 +39,20 @@ GribSection4::GribSection4(int section_length):
     init();
 }
 
-bool GribSection4::parseFile(std::FILE* file, bool header_only) {
-    const auto buffer_length = section_length_ - 5;
-    std::vector<std::byte> buffer(section_length_);
-    const auto read_count = std::fread(&buffer[5], 1, buffer_length, file);
-    if (static_cast<long>(read_count) != buffer_length) {
+bool GribSection4::resetSection(long section_length) {
+    if (section_length < 9) {
+        return false;
+    }
+    setSectionLength(section_length);
+    return true;
+}
+
+bool GribSection4::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (static_cast<long>(bytes.size()) < section_length_) {
         return false;
     }
 
-    auto iterator = std::cbegin(buffer) + 5;
+    auto iterator = bytes.data() + 5;
 
     auto component_span = gsl::make_span(components_);
     auto sub_component_span = component_span.subspan(2);
@@ -57,18 +78,13 @@ void GribSection4::init() {
         this->generateProductionTemplate(template_component);
     });
 
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {4, "section4Length", &section_length_},
-        {1, "numberOfSection", &section_number_},
-        {2, "nv", &nv_},
-        {2, "productDefinitionTemplateNumber", &product_definition_template_number_},
-    };
+    // template follows fixed fields from octet 10.
+    static_assert(is_valid_octet_layout(octetLayout(), 1, 10), "section 4 layout");
 
-    for (auto& item : components) {
-        components_.push_back(
-            std::make_unique<PropertyComponent>(std::get<0>(item), std::get<1>(item), std::get<2>(item)));
-        registerProperty(std::get<1>(item), std::get<2>(item));
-    }
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+        registerProperty(name, property);
+    });
 
     components_.push_back(std::make_unique<TemplateComponent>(product_definition_template_number_));
 
@@ -81,30 +97,61 @@ void GribSection4::init() {
 }
 
 void GribSection4::generateProductionTemplate(TemplateComponent* template_component) {
+    auto template_length = section_length_.getLong()- 9;
+    auto product_definition_template_number = product_definition_template_number_.getLong();
+
+    // template is parsed again in place when section is reused.
+    if (product_definition_template_number == generated_template_number_
+        && template_length == generated_template_length_) {
+        return;
+    }
+
+    // throw before current template is replaced if template is not implemented.
+    auto grib_template = createProductionTemplate(product_definition_template_number, template_length);
+
     auto section = std::dynamic_pointer_cast<GribSection>(shared_from_this());
 
     template_component->unregisterProperty(section);
 
-    auto template_length = section_length_.getLong()- 9;
+    auto current_template = template_component->releaseTemplate();
+    if (current_template) {
+        spare_templates_.emplace_back(
+            generated_template_number_, generated_template_length_, std::move(current_template));
+    }
 
-    auto product_definition_template_number = product_definition_template_number_.getLong();
-    if (product_definition_template_number == 0) {
-        template_component->setTemplate(std::make_unique<Template_4_0>(template_length));
+    template_component->setTemplate(std::move(grib_template));
+    template_component->registerProperty(section);
+
+    generated_template_number_ = product_definition_template_number;
+    generated_template_length_ = template_length;
+}
+
+std::unique_ptr<GribTemplate> GribSection4::createProductionTemplate(long template_number, long template_length) {
+    const auto spare_template = std::find_if(
+        std::begin(spare_templates_), std::end(spare_templates_), [=](const auto& item) {
+            return std::get<0>(item) == template_number && std::get<1>(item) == template_length;
+        });
+    if (spare_template != std::end(spare_templates_)) {
+        auto grib_template = std::move(std::get<2>(*spare_template));
+        spare_templates_.erase(spare_template);
+        return grib_template;
     }
-    else if (product_definition_template_number == 1) {
-        template_component->setTemplate(std::make_unique<Template_4_1>(template_length));
+
+    if (template_number == 0) {
+        return std::make_unique<Template_4_0>(template_length);
+    }
+    else if (template_number == 1) {
+        return std::make_unique<Template_4_1>(template_length);
     }
-    else if (product_definition_template_number == 8) {
-        template_component->setTemplate(std::make_unique<Template_4_8>(template_length));
+    else if (template_number == 8) {
+        return std::make_unique<Template_4_8>(template_length);
     }
-    else if (product_definition_template_number == 11) {
-        template_component->setTemplate(std::make_unique<Template_4_11>(template_length));
+    else if (template_number == 11) {
+        return std::make_unique<Template_4_11>(template_length);
     }
     else {
-        throw std::runtime_error(
-            fmt::format("template not implemented: {}", product_definition_template_number));
+        throw std::runtime_error(fmt::format("template not implemented: {}", template_number));
     }
-    template_component->registerProperty(section);
 }
 
 } // namespace grib_coder
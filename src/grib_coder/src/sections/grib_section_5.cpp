@@ -1,4 +1,5 @@
 #include <grib_coder/sections/grib_section_5.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 
 #include <gsl/span>
@@ -6,6 +7,40 @@
 #include <cassert>
 
 namespace grib_coder {
+
+namespace {
+
+// length of section 5 with template 5.0.
+const long simple_packing_section_length = 21;
+
+} // namespace
+
+constexpr auto GribSection5::octetLayout() {
+    return std::make_tuple(
+        octet_field(1, 4, "section5Length", &GribSection5::section_length_),
+        octet_field(5, 1, "numberOfSection", &GribSection5::section_number_),
+        octet_field(6, 4, "numberOfValues", &GribSection5::number_of_values_),
+        octet_field(10, 2, "dataRepresentationTemplateNumber", &GribSection5::data_representation_template_number_),
+        octet_field(12, 4, "referenceValue", &GribSection5::reference_value_),
+        octet_field(16, 2, "binaryScaleFactor", &GribSection5::binary_scale_factor_),
+        octet_field(18, 2, "decimalScaleFactor", &GribSection5::decimal_scale_factor_),
+        octet_field(20, 1, "bitsPerValue", &GribSection5::bits_per_value_),
+        octet_field(21, 1, "typeOfOriginalFieldValues", &GribSection5::type_of_original_field_values_)
+    );
+}
+
+constexpr auto GribSection5::jpeg2000OctetLayout() {
+    return std::make_tuple(
+        octet_field(22, 1, "typeOfCompressionUsed", &GribSection5::type_of_compression_used_),
+        octet_field(23, 1, "targetCompressionRatio", &GribSection5::target_compression_ratio_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> GribSection5::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(std::tuple_cat(octetLayout(), jpeg2000OctetLayout()));
+    return fields;
+}
+
 GribSection5::GribSection5():
     GribSection{5} {
     init();
@@ -13,25 +48,18 @@ GribSection5::GribSection5():
 
 GribSection5::GribSection5(int section_length):
     GribSection{5, section_length} {
-    assert(section_length == 23);
+    assert(section_length == simple_packing_section_length || section_length == 23);
     init();
 }
 
-bool GribSection5::parseFile(std::FILE* file, bool header_only) {
-    const auto buffer_length = section_length_ - 5;
-    std::vector<std::byte> buffer(section_length_);
-    const auto read_count = std::fread(&buffer[5], 1, buffer_length, file);
-    if (static_cast<long>(read_count) != buffer_length) {
+bool GribSection5::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (static_cast<long>(bytes.size()) < section_length_) {
         return false;
     }
 
-    auto iterator = std::cbegin(buffer) + 5;
-
-    auto component_span = gsl::make_span(components_);
-    auto sub_component_span = component_span.subspan(2);
-
-    for (auto& component : sub_component_span) {
-        component->parse(iterator);
+    unpack_octet_fields(*this, bytes.data(), octetLayout());
+    if (hasJpeg2000Fields()) {
+        unpack_octet_fields(*this, bytes.data(), jpeg2000OctetLayout());
     }
 
     return true;
@@ -42,30 +70,23 @@ bool GribSection5::decode(GribMessageHandler* container) {
     return result;
 }
 
+bool GribSection5::hasJpeg2000Fields() const {
+    return section_length_ != simple_packing_section_length;
+}
+
 void GribSection5::init() {
     data_representation_template_number_.setByteCount(2);
 
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {4, "section5Length", &section_length_},
-        {1, "numberOfSection", &section_number_},
-        {4, "numberOfValues", &number_of_values_},
-        {2, "dataRepresentationTemplateNumber", &data_representation_template_number_},
-
-        {4, "referenceValue", &reference_value_},
-        {2, "binaryScaleFactor", &binary_scale_factor_},
-        {2, "decimalScaleFactor", &decimal_scale_factor_},
-        {1, "bitsPerValue", &bits_per_value_},
-        {1, "typeOfOriginalFieldValues", &type_of_original_field_values_},
-        {1, "typeOfCompressionUsed", &type_of_compression_used_},
-        {1, "targetCompressionRatio", &target_compression_ratio_},
-    };
+    static_assert(is_valid_octet_layout(octetLayout(), 1, 22), "section 5 layout");
+    static_assert(is_valid_octet_layout(jpeg2000OctetLayout(), 22, 24), "section 5 template 5.40 layout");
 
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-            std::get<0>(item),
-            std::get<1>(item),
-            std::get<2>(item)));
-        registerProperty(std::get<1>(item), std::get<2>(item));
+    const auto add_component = [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+        registerProperty(name, property);
+    };
+    for_each_octet_field(*this, octetLayout(), add_component);
+    if (hasJpeg2000Fields()) {
+        for_each_octet_field(*this, jpeg2000OctetLayout(), add_component);
     }
 
     std::vector<std::tuple<CodeTableProperty*, std::string>> tables_id{
@@ -1,9 +1,23 @@
 #include <grib_coder/sections/grib_section_6.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 
 #include <gsl/span>
 
 namespace grib_coder {
+constexpr auto GribSection6::octetLayout() {
+    return std::make_tuple(
+        octet_field(1, 4, "section6Length", &GribSection6::section_length_),
+        octet_field(5, 1, "numberOfSection", &GribSection6::section_number_),
+        octet_field(6, 1, "bitMapIndicator", &GribSection6::bit_map_indicator_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> GribSection6::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 GribSection6::GribSection6():
     GribSection{6} {
     init();
@@ -15,31 +29,27 @@ GribSection6::GribSection6(int section_length):
     init();
 }
 
-bool GribSection6::parseFile(std::FILE* file, bool header_only) {
-    const auto buffer_length = section_length_ - 5;
-    std::vector<std::byte> buffer(section_length_);
-    const auto read_count = std::fread(&buffer[5], 1, buffer_length, file);
-    if (static_cast<long>(read_count) != buffer_length) {
+bool GribSection6::resetSection(long section_length) {
+    if (section_length < 6) {
         return false;
     }
+    setSectionLength(section_length);
+    return true;
+}
 
-    auto iterator = std::cbegin(buffer) + 5;
-
-    auto component_span = gsl::make_span(components_);
-    auto sub_component_span = component_span.subspan(2);
-
-    for (auto& component : sub_component_span) {
-        component->parse(iterator);
+bool GribSection6::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (static_cast<long>(bytes.size()) < section_length_) {
+        return false;
     }
 
+    unpack_octet_fields(*this, bytes.data(), octetLayout());
+
     if(bit_map_indicator_.getLong() == 255) {
+        bit_map_values_.setRawValuesView({});
         return true;
     }
 
-    std::vector<std::byte> raw_bytes;
-    raw_bytes.resize(buffer_length - 1);
-    std::copy(buffer.begin() + 6, buffer.end(), raw_bytes.begin());
-    bit_map_values_.setRawValues(std::move(raw_bytes));
+    bit_map_values_.setRawValuesView(bytes.subspan(6, section_length_ - 6));
 
     return true;
 }
@@ -54,19 +64,12 @@ bool GribSection6::decodeValues(GribMessageHandler* handler) {
 }
 
 void GribSection6::init() {
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {4, "section6Length", &section_length_},
-        {1, "numberOfSection", &section_number_},
-        {1, "bitMapIndicator", &bit_map_indicator_},
-    };
-
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-            std::get<0>(item),
-            std::get<1>(item),
-            std::get<2>(item)));
-        registerProperty(std::get<1>(item), std::get<2>(item));
-    }
+    static_assert(is_valid_octet_layout(octetLayout(), 1, 7), "section 6 layout");
+
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+        registerProperty(name, property);
+    });
 
     registerProperty("bitmap", &bit_map_values_);
 }
@@ -2,6 +2,7 @@
 #include <grib_property/property_component.h>
 
 #include <algorithm>
+#include <stdexcept>
 
 namespace grib_coder {
 GribSection7::GribSection7():
@@ -14,32 +15,42 @@ GribSection7::GribSection7(int section_length):
     init();
 }
 
+bool GribSection7::resetSection(long section_length) {
+    if (section_length < 5) {
+        return false;
+    }
+    setSectionLength(section_length);
+    deferred_file_ = nullptr;
+    raw_values_released_ = false;
+    values_decoded_ = false;
+    return true;
+}
+
 bool GribSection7::parseFile(std::FILE* file, bool header_only) {
+    if (!header_only) {
+        return GribSection::parseFile(file, header_only);
+    }
+
     const auto buffer_length = section_length_ - 5;
+    setDataValuesComponent(buffer_length);
+    data_values_.setRawValuesView({});
     if (buffer_length == 0) {
         return true;
     }
 
-    components_.push_back(std::make_unique<PropertyComponent>(
-        buffer_length,
-        "dataValues",
-        &data_values_
-    ));
+    deferred_file_ = file;
+    deferred_offset_ = std::ftell(file);
+    return std::fseek(file, buffer_length, SEEK_CUR) == 0;
+}
 
-    // if (header_only) {
-    //     std::fseek(file, buffer_length, SEEK_CUR);
-    // } else {
-    std::vector<std::byte> buffer(section_length_);
-    const auto read_count = std::fread(&buffer[5], 1, buffer_length, file);
-    if (static_cast<long>(read_count) != buffer_length) {
+bool GribSection7::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    const auto buffer_length = section_length_ - 5;
+    if (static_cast<long>(bytes.size()) < section_length_) {
         return false;
     }
 
-    std::vector<std::byte> raw_value_bytes;
-    raw_value_bytes.resize(buffer_length);
-    std::copy(buffer.begin() + 5, buffer.end(), raw_value_bytes.begin());
-    data_values_.setRawValues(std::move(raw_value_bytes));
-    // }
+    setDataValuesComponent(buffer_length);
+    data_values_.setRawValuesView(bytes.subspan(5, buffer_length));
 
     return true;
 }
@@ -49,19 +60,62 @@ bool GribSection7::decode(GribMessageHandler* container) {
 }
 
 bool GribSection7::decodeValues(GribMessageHandler* container) {
-    return data_values_.decodeValues(container);
+    // decoding empty bytes would replace values with a constant field.
+    if (raw_values_released_) {
+        return values_decoded_;
+    }
+    if (!loadDeferredValues()) {
+        return false;
+    }
+    values_decoded_ = data_values_.decodeValues(container);
+    return values_decoded_;
+}
+
+bool GribSection7::decodeValues(GribMessageHandler* container, gsl::span<double> values) {
+    return decodeValuesInto(container, values);
+}
+
+bool GribSection7::decodeValues(GribMessageHandler* container, gsl::span<float> values) {
+    return decodeValuesInto(container, values);
+}
+
+template <typename T>
+bool GribSection7::decodeValuesInto(GribMessageHandler* container, gsl::span<T> values) {
+    if (raw_values_released_) {
+        return values_decoded_ && data_values_.getValues(values);
+    }
+    if (!loadDeferredValues()) {
+        return false;
+    }
+    return data_values_.decodeValues(container, values);
 }
 
 bool GribSection7::encodeValues(GribMessageHandler* container) {
+    // encoded values replace data values in file.
+    deferred_file_ = nullptr;
+    raw_values_released_ = false;
     return data_values_.encodeValues(container);
 }
 
+void GribSection7::releaseRawValues() {
+    deferred_file_ = nullptr;
+    raw_values_released_ = true;
+    data_values_.releaseRawValues();
+    std::vector<std::byte>{}.swap(buffer_);
+}
+
 bool GribSection7::encode(GribMessageHandler* handler) {
     encodeValues(handler);
     return GribSection::encode(handler);
 }
 
 void GribSection7::pack(std::back_insert_iterator<std::vector<std::byte>>& iterator) {
+    if (raw_values_released_) {
+        throw std::runtime_error("data values are released");
+    }
+    if (!loadDeferredValues()) {
+        throw std::runtime_error("data values can't be read from file");
+    }
     GribSection::pack(iterator);
 }
 
@@ -88,6 +142,47 @@ void GribSection7::init() {
     }
 }
 
+bool GribSection7::loadDeferredValues() {
+    if (deferred_file_ == nullptr) {
+        return true;
+    }
+
+    const auto buffer_length = section_length_ - 5;
+    buffer_.resize(section_length_);
+
+    const auto current_pos = std::ftell(deferred_file_);
+    std::fseek(deferred_file_, deferred_offset_, SEEK_SET);
+    const auto read_count = std::fread(buffer_.data() + 5, 1, buffer_length, deferred_file_);
+    std::fseek(deferred_file_, current_pos, SEEK_SET);
+
+    if (static_cast<long>(read_count) != buffer_length) {
+        return false;
+    }
+
+    data_values_.setRawValuesView(gsl::span<const std::byte>{buffer_}.subspan(5, buffer_length));
+    deferred_file_ = nullptr;
+    return true;
+}
+
+void GribSection7::setDataValuesComponent(long byte_count) {
+    // constant field has no data values.
+    if (byte_count == 0) {
+        components_.resize(2);
+        return;
+    }
+
+    if (components_.size() > 2) {
+        static_cast<PropertyComponent*>(components_[2].get())->setByteCount(byte_count);
+        return;
+    }
+
+    components_.push_back(std::make_unique<PropertyComponent>(
+        byte_count,
+        "dataValues",
+        &data_values_
+    ));
+}
+
 void GribSection7::updateSectionLength() {
     section_length_ = 5 + data_values_.getByteCount();
 }
@@ -15,7 +15,15 @@ bool GribSection8::parseFile(std::FILE* file, bool header_only) {
         return false;
     }
 
-    auto iterator = std::cbegin(buffer);
+    return parseBytes(buffer, header_only);
+}
+
+bool GribSection8::parseBytes(gsl::span<const std::byte> bytes, bool header_only) {
+    if (bytes.size() < 4) {
+        return false;
+    }
+
+    auto iterator = bytes.data();
     for (auto& component : components_) {
         component->parse(iterator);
     }
@@ -12,7 +12,7 @@ void TemplateCodeTableProperty::setTemplateComponent(TemplateComponent* template
     template_component_ = template_component;
 }
 
-bool TemplateCodeTableProperty::parse(std::vector<std::byte>::const_iterator& iterator, size_t count) {
+bool TemplateCodeTableProperty::parse(const std::byte*& iterator, size_t count) {
     const auto result = CodeTableProperty::parse(iterator, count);
 	if(!result) {
         return result;
@@ -14,8 +14,12 @@ void TemplateComponent::setTemplate(std::unique_ptr<GribTemplate>&& grib_templat
     grib_template_ = std::move(grib_template);
 }
 
+std::unique_ptr<GribTemplate> TemplateComponent::releaseTemplate() {
+    return std::move(grib_template_);
+}
+
 
-bool TemplateComponent::parse(std::vector<std::byte>::const_iterator& iterator) {
+bool TemplateComponent::parse(const std::byte*& iterator) {
     return grib_template_->parse(iterator);;
 }
 
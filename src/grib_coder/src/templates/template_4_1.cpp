@@ -1,18 +1,54 @@
 #include <grib_coder/templates/template_4_1.h>
 #include <grib_coder/grib_section.h>
 #include <grib_coder/grib_message_handler.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 
 #include <cassert>
 
 namespace grib_coder {
 
+constexpr auto Template_4_1::octetLayout() {
+    return std::make_tuple(
+        octet_field(10, 1, "parameterCategory", &Template_4_1::parameter_category_),
+        octet_field(11, 1, "parameterNumber", &Template_4_1::parameter_number_),
+        octet_field(12, 1, "typeOfGeneratingProcess", &Template_4_1::type_of_generating_process_),
+        octet_field(13, 1, "backgroundProcess", &Template_4_1::background_process_),
+        octet_field(14, 1, "generatingProcessIdentifier", &Template_4_1::generating_process_identifier_),
+        octet_field(15, 2, "hoursAfterDataCutoff", &Template_4_1::hours_after_data_cutoff_),
+        octet_field(17, 1, "minutesAfterDataCutoff", &Template_4_1::minutes_after_data_cutoff_),
+        octet_field(18, 1, "indicatorOfUnitOfTimeRange", &Template_4_1::indicator_of_unit_of_time_range_),
+        octet_field(19, 4, "forecastTime", &Template_4_1::forecast_time_),
+        octet_field(23, 1, "typeOfFirstFixedSurface", &Template_4_1::type_of_first_fixed_surface_),
+        octet_field(24, 1, "scaleFactorOfFirstFixedSurface", &Template_4_1::scale_factor_of_first_fixed_surface_),
+        octet_field(25, 4, "scaledValueOfFirstFixedSurface", &Template_4_1::scaled_value_of_first_fixed_surface_),
+        octet_field(29, 1, "typeOfSecondFixedSurface", &Template_4_1::type_of_second_fixed_surface_),
+        octet_field(30, 1, "scaleFactorOfSecondFixedSurface", &Template_4_1::scale_factor_of_second_fixed_surface_),
+        octet_field(31, 4, "scaledValueOfSecondFixedSurface", &Template_4_1::scaled_value_of_second_fixed_surface_),
+        octet_field(35, 1, "typeOfEnsembleForecast", &Template_4_1::type_of_ensemble_forecast_),
+        octet_field(36, 1, "perturbationNumber", &Template_4_1::perturbation_number_),
+        octet_field(37, 1, "numberOfForecastInEnsemble", &Template_4_1::number_of_forecasts_in_ensemble_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> Template_4_1::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 Template_4_1::Template_4_1(int template_length):
     GribTemplate{template_length} {
     assert(template_length == 37 - 9);
     init();
 }
 
+bool Template_4_1::parse(const std::byte*& iterator) {
+    // template begins at octet 10 of section 4.
+    unpack_octet_fields(*this, iterator - 9, octetLayout());
+    iterator += template_length_;
+    return true;
+}
+
 bool Template_4_1::decode(GribMessageHandler* container) {
     const auto discipline = container->getLong("discipline");
     const auto category_table_id = fmt::format("4.1.{discipline}", fmt::arg("discipline", discipline));
@@ -45,34 +81,11 @@ void Template_4_1::registerProperty(std::shared_ptr<GribSection> &section) {
 }
 
 void Template_4_1::init() {
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {1, "parameterCategory", &parameter_category_},
-        {1, "parameterNumber", &parameter_number_},
-        {1, "typeOfGeneratingProcess", &type_of_generating_process_},
-        {1, "backgroundProcess", &background_process_},
-        {1, "generatingProcessIdentifier", &generating_process_identifier_},
-        {2, "hoursAfterDataCutoff", &hours_after_data_cutoff_},
-        {1, "minutesAfterDataCutoff", &minutes_after_data_cutoff_},
-        {1, "indicatorOfUnitOfTimeRange", &indicator_of_unit_of_time_range_},
-        {4, "forecastTime", &forecast_time_},
-        {1, "typeOfFirstFixedSurface", &type_of_first_fixed_surface_},
-        {1, "scaleFactorOfFirstFixedSurface", &scale_factor_of_first_fixed_surface_},
-        {4, "scaledValueOfFirstFixedSurface", &scaled_value_of_first_fixed_surface_},
-        {1, "typeOfSecondFixedSurface", &type_of_second_fixed_surface_},
-        {1, "scaleFactorOfSecondFixedSurface", &scale_factor_of_second_fixed_surface_},
-        {4, "scaledValueOfSecondFixedSurface", &scaled_value_of_second_fixed_surface_},
-
-        {1, "typeOfEnsembleForecast", &type_of_ensemble_forecast_},
-        {1, "perturbationNumber", &perturbation_number_},
-        {1, "numberOfForecastInEnsemble", &number_of_forecasts_in_ensemble_},
-    };
+    static_assert(is_valid_octet_layout(octetLayout(), 10, 38), "template 4.1 layout");
 
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-            std::get<0>(item),
-            std::get<1>(item),
-            std::get<2>(item)));
-    }
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+    });
 
     std::vector<std::tuple<CodeTableProperty*, std::string>> tables_id{
         {&type_of_generating_process_, "4.3"},
@@ -1,6 +1,7 @@
 #include <grib_coder/templates/template_4_8.h>
 #include <grib_coder/grib_section.h>
 #include <grib_coder/grib_message_handler.h>
+#include <grib_coder/octet_layout.h>
 #include <grib_property/property_component.h>
 
 #include <tuple>
@@ -8,12 +9,58 @@
 
 namespace grib_coder {
 
+constexpr auto Template_4_8::octetLayout() {
+    return std::make_tuple(
+        octet_field(10, 1, "parameterCategory", &Template_4_8::parameter_category_),
+        octet_field(11, 1, "parameterNumber", &Template_4_8::parameter_number_),
+        octet_field(12, 1, "typeOfGeneratingProcess", &Template_4_8::type_of_generating_process_),
+        octet_field(13, 1, "backgroundProcess", &Template_4_8::background_process_),
+        octet_field(14, 1, "generatingProcessIdentifier", &Template_4_8::generating_process_identifier_),
+        octet_field(15, 2, "hoursAfterDataCutoff", &Template_4_8::hours_after_data_cutoff_),
+        octet_field(17, 1, "minutesAfterDataCutoff", &Template_4_8::minutes_after_data_cutoff_),
+        octet_field(18, 1, "indicatorOfUnitOfTimeRange", &Template_4_8::indicator_of_unit_of_time_range_),
+        octet_field(19, 4, "forecastTime", &Template_4_8::forecast_time_),
+        octet_field(23, 1, "typeOfFirstFixedSurface", &Template_4_8::type_of_first_fixed_surface_),
+        octet_field(24, 1, "scaleFactorOfFirstFixedSurface", &Template_4_8::scale_factor_of_first_fixed_surface_),
+        octet_field(25, 4, "scaledValueOfFirstFixedSurface", &Template_4_8::scaled_value_of_first_fixed_surface_),
+        octet_field(29, 1, "typeOfSecondFixedSurface", &Template_4_8::type_of_second_fixed_surface_),
+        octet_field(30, 1, "scaleFactorOfSecondFixedSurface", &Template_4_8::scale_factor_of_second_fixed_surface_),
+        octet_field(31, 4, "scaledValueOfSecondFixedSurface", &Template_4_8::scaled_value_of_second_fixed_surface_),
+        octet_field(35, 2, "yearOfEndOfOverallTimeInterval", &Template_4_8::year_of_end_of_overall_time_interval_),
+        octet_field(37, 1, "monthOfEndOfOverallTimeInterval", &Template_4_8::month_of_end_of_overall_time_interval_),
+        octet_field(38, 1, "dayOfEndOfOverallTimeInterval", &Template_4_8::day_of_end_of_overall_time_interval_),
+        octet_field(39, 1, "hourOfEndOfOverallTimeInterval", &Template_4_8::hour_of_end_of_overall_time_interval_),
+        octet_field(40, 1, "minuteOfEndOfOverallTimeInterval", &Template_4_8::minute_of_end_of_overall_time_interval_),
+        octet_field(41, 1, "secondOfEndOfOverallTimeInterval", &Template_4_8::second_of_end_of_overall_time_interval_),
+        octet_field(42, 1, "numberOfTimeRange", &Template_4_8::number_of_time_range_),
+        octet_field(43, 4, "numberOfMissingInStatisticalProcess", &Template_4_8::number_of_missing_statistical_process_),
+        octet_field(47, 1, "typeOfStatisticalProcessing", &Template_4_8::type_of_statistical_processing_),
+        octet_field(48, 1, "typeOfTimeIncrement", &Template_4_8::type_of_time_increment_),
+        octet_field(49, 1, "indicatorOfUnitForTimeRange", &Template_4_8::indicator_of_unit_for_time_range_),
+        octet_field(50, 4, "lengthOfTimeRange", &Template_4_8::length_of_time_range_),
+        octet_field(54, 1, "indicatorOfUnitForTimeIncrement", &Template_4_8::indicator_of_unit_for_time_increment_),
+        octet_field(55, 4, "timeIncrement", &Template_4_8::time_increment_)
+    );
+}
+
+gsl::span<const OctetFieldInfo> Template_4_8::getOctetFields() {
+    static constexpr auto fields = octet_field_infos(octetLayout());
+    return fields;
+}
+
 Template_4_8::Template_4_8(int template_length):
     GribTemplate{template_length} {
     assert(template_length == 58 - 9);
     init();
 }
 
+bool Template_4_8::parse(const std::byte*& iterator) {
+    // template begins at octet 10 of section 4.
+    unpack_octet_fields(*this, iterator - 9, octetLayout());
+    iterator += template_length_;
+    return true;
+}
+
 bool Template_4_8::decode(GribMessageHandler* handler) {
     const auto discipline = handler->getLong("discipline");
     const auto category_table_id = fmt::format("4.1.{discipline}", fmt::arg("discipline", discipline));
@@ -46,46 +93,11 @@ void Template_4_8::registerProperty(std::shared_ptr<GribSection> &section) {
 }
 
 void Template_4_8::init() {
-    std::vector<std::tuple<size_t, std::string, GribProperty*>> components{
-        {1, "parameterCategory", &parameter_category_},
-        {1, "parameterNumber", &parameter_number_},
-        {1, "typeOfGeneratingProcess", &type_of_generating_process_},
-        {1, "backgroundProcess", &background_process_},
-        {1, "generatingProcessIdentifier", &generating_process_identifier_},
-        {2, "hoursAfterDataCutoff", &hours_after_data_cutoff_},
-        {1, "minutesAfterDataCutoff", &minutes_after_data_cutoff_},
-        {1, "indicatorOfUnitOfTimeRange", &indicator_of_unit_of_time_range_},
-        {4, "forecastTime", &forecast_time_},
-        {1, "typeOfFirstFixedSurface", &type_of_first_fixed_surface_},
-        {1, "scaleFactorOfFirstFixedSurface", &scale_factor_of_first_fixed_surface_},
-        {4, "scaledValueOfFirstFixedSurface", &scaled_value_of_first_fixed_surface_},
-        {1, "typeOfSecondFixedSurface", &type_of_second_fixed_surface_},
-        {1, "scaleFactorOfSecondFixedSurface", &scale_factor_of_second_fixed_surface_},
-        {4, "scaledValueOfSecondFixedSurface", &scaled_value_of_second_fixed_surface_},
-
-        {2, "yearOfEndOfOverallTimeInterval", &year_of_end_of_overall_time_interval_},
-        {1, "monthOfEndOfOverallTimeInterval", &month_of_end_of_overall_time_interval_},
-        {1, "dayOfEndOfOverallTimeInterval", &day_of_end_of_overall_time_interval_},
-        {1, "hourOfEndOfOverallTimeInterval", &hour_of_end_of_overall_time_interval_},
-        {1, "minuteOfEndOfOverallTimeInterval", &minute_of_end_of_overall_time_interval_},
-        {1, "secondOfEndOfOverallTimeInterval", &second_of_end_of_overall_time_interval_},
-        {1, "numberOfTimeRange", &number_of_time_range_},
-        {4, "numberOfMissingInStatisticalProcess", &number_of_missing_statistical_process_},
-
-        {1, "typeOfStatisticalProcessing", &type_of_statistical_processing_},
-        {1, "typeOfTimeIncrement", &type_of_time_increment_},
-        {1, "indicatorOfUnitForTimeRange", &indicator_of_unit_for_time_range_},
-        {4, "lengthOfTimeRange", &length_of_time_range_},
-        {1, "indicatorOfUnitForTimeIncrement", &indicator_of_unit_for_time_increment_},
-        {4, "timeIncrement", &time_increment_},
-    };
+    static_assert(is_valid_octet_layout(octetLayout(), 10, 59), "template 4.8 layout");
 
-    for (auto& item : components) {
-        components_.push_back(std::make_unique<PropertyComponent>(
-            std::get<0>(item),
-            std::get<1>(item),
-            std::get<2>(item)));
-    }
+    for_each_octet_field(*this, octetLayout(), [this](size_t length, const char* name, GribProperty* property) {
+        components_.push_back(std::make_unique<PropertyComponent>(length, name, property));
+    });
 
     const std::vector<std::tuple<CodeTableProperty*, std::string>> properties = {
         {&type_of_generating_process_, "4.3"},
@@ -37,8 +37,13 @@ public:
     auto getValue() const {
         return value_;
     }
+
+    // set value without virtual call, used by decoders of fixed layouts.
+    void setValue(long value) {
+        value_ = value;
+    }
     
-    bool parse(std::vector<std::byte>::const_iterator& iterator, size_t count = 1) override;
+    bool parse(const std::byte*& iterator, size_t count = 1) override;
 
     void dump(const DumpConfig& dump_config) override;
 
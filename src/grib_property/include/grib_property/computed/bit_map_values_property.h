@@ -1,6 +1,8 @@
 #pragma once
 #include <grib_property/grib_property.h>
 
+#include <gsl/span>
+
 namespace grib_coder {
 
 class BitMapValuesProperty : public GribProperty {
@@ -9,7 +11,10 @@ public:
     
     void setRawValues(std::vector<std::byte>&& raw_values);
 
-    std::vector<bool> getValues() const {
+    // use bytes owned by others (section buffer or memory mapped file) without copying.
+    void setRawValuesView(gsl::span<const std::byte> raw_values);
+
+    const std::vector<bool>& getValues() const {
         return values_;
     }
 
@@ -23,6 +28,9 @@ public:
 
 private:
     std::vector<std::byte> raw_bytes_;
+
+    // raw bytes used in decoding, points to raw_bytes_ or bytes owned by others.
+    gsl::span<const std::byte> raw_bytes_view_;
     std::vector<bool> values_;
 };
 
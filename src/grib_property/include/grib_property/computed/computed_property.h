@@ -3,15 +3,35 @@
 #include <grib_property/grib_property.h>
 
 namespace grib_coder {
+
+// property computed from other properties of message.
+//
+// Value is not computed in decode, but on the first access after decode, and kept until next decode,
+// so parsing headers only costs computed properties which are read.
 class ComputedProperty: public GribProperty {
 public:
+    // keep message handler and drop computed value of previous message.
     bool decode(GribMessageHandler* handler) override;
 
 protected:
+    // compute value from properties of message handler.
+    virtual bool compute(GribMessageHandler* handler) = 0;
+
+    // compute value if it is not computed since last decode, should be called by all getters.
+    void computeIfNeeded() {
+        if (!computed_ && message_handler_ != nullptr) {
+            computed_ = true;
+            compute(message_handler_);
+        }
+    }
+
     // write value back to components, should be called by all available setters.
     virtual void encodeToComponents() = 0;
 
     // computed property needs message handler to write value back to components.
     GribMessageHandler* message_handler_ = nullptr;
+
+    // value set by setters is not computed again.
+    bool computed_ = false;
 };
-} // namespace grib_coder
\ No newline at end of file
+} // namespace grib_coder
@@ -13,9 +13,9 @@ public:
     void setString(const std::string& value) override;
     std::string getString() override;
 
-    bool decode(GribMessageHandler* handler) override;
-
 private:
+    bool compute(GribMessageHandler* handler) override;
+
     void encodeToComponents() override;
 
     int year_ = -1;
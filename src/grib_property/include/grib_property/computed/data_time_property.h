@@ -14,9 +14,9 @@ public:
     void setString(const std::string& value) override;
     std::string getString() override;
 
-    bool decode(GribMessageHandler* container) override;
-
 private:
+    bool compute(GribMessageHandler* container) override;
+
     void encodeToComponents() override;
 
     int hour_ = -1;
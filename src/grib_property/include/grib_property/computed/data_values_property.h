@@ -1,6 +1,8 @@
 #pragma once
 #include <grib_property/grib_property.h>
 
+#include <gsl/span>
+
 namespace grib_coder {
 
 class DataValuesProperty : public GribProperty {
@@ -9,18 +11,40 @@ public:
     ~DataValuesProperty() = default;
 
     long getByteCount() const {
-        return raw_value_bytes_.size();
+        return raw_value_view_.size();
     }
 
     void setDoubleArray(std::vector<double>& values) override;
     std::vector<double> getDoubleArray() override;
 
+    // decoded values without copying, valid until values are decoded again. empty if values are not decoded.
+    gsl::span<const double> getValues() const {
+        return values_;
+    }
+
+    // copy decoded values into buffer of caller.
+    // return false if values are not decoded or size of buffer is not equal to count of values.
+    bool getValues(gsl::span<double> values) const;
+    bool getValues(gsl::span<float> values) const;
+
     void setRawValues(std::vector<std::byte>&& raw_values);
 
+    // use bytes owned by others (section buffer or memory mapped file) without copying.
+    void setRawValuesView(gsl::span<const std::byte> raw_values);
+
+    // drop raw bytes after values are decoded, when values will not be encoded or packed again.
+    void releaseRawValues();
+
     // decode, dump and encode
 
     bool decodeValues(GribMessageHandler* container);
 
+    // decode values directly into buffer of caller without keeping them in property.
+    // size of buffer should be equal to count of points, which is numberOfValues if there is no bitmap.
+    // With bitmap, values are decoded into the end of buffer and moved to their points, without another buffer.
+    bool decodeValues(GribMessageHandler* container, gsl::span<double> values);
+    bool decodeValues(GribMessageHandler* container, gsl::span<float> values);
+
     void dump(const DumpConfig& dump_config) override;
 
     bool encodeValues(GribMessageHandler* container);
@@ -37,13 +61,28 @@ private:
 
     bool decodeNormalFields(GribMessageHandler* container);
 
+    template <typename T>
+    bool decodeValuesInto(GribMessageHandler* container, gsl::span<T> values);
+
+    // decode packed values and expand them to points set in bitmap, count of values is size of bitmap.
+    template <typename T>
+    bool decodeBitmapValues(GribMessageHandler* container, gsl::span<T> values);
+
+    // decode packed values into values by data representation template, count of values is size of values.
+    template <typename T>
+    bool decodePackedValues(GribMessageHandler* container, gsl::span<T> values);
+
     // encode referenceValue for constant fields.
     bool encodeConstantFields(GribMessageHandler* container);
 
     bool encodeNormalFields(GribMessageHandler* container);
 
+    // bytes owned by property, such as encoded values.
     std::vector<std::byte> raw_value_bytes_;
-    std::vector<double> codes_values_;
+
+    // raw bytes used in decoding and packing, points to raw_value_bytes_ or bytes owned by others.
+    gsl::span<const std::byte> raw_value_view_;
+
     std::vector<double> values_;
     long data_count_ = -1;
 };
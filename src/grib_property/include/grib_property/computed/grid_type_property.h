@@ -6,12 +6,13 @@ namespace grib_coder {
 class GridTypeProperty : public ComputedProperty {
 public:
     std::string getString() override {
+        computeIfNeeded();
         return grid_type_;
     }
 
-    bool decode(GribMessageHandler* handler) override;
-
 private:
+    bool compute(GribMessageHandler* handler) override;
+
     void encodeToComponents() override;
 
     std::string grid_type_ = "MISSING";
@@ -6,14 +6,15 @@ namespace grib_coder {
 class LevelProperty : public ComputedProperty {
 public:
     double getDouble() override {
+        computeIfNeeded();
         return value_;
     }
 
     std::string getString() override;
 
-    bool decode(GribMessageHandler* handler) override;
-
 private:
+    bool compute(GribMessageHandler* handler) override;
+
     void encodeToComponents() override;
 
     double value_ = std::numeric_limits<double>::max();
@@ -4,9 +4,19 @@
 #include <cstddef>
 #include <grib_property/computed/openjpeg_helper.h>
 
+#include <gsl/span>
+
 namespace grib_coder {
 
-std::vector<double> decode_jpeg2000_values(std::byte* buf, size_t raw_data_length, size_t data_count);
+// decode codes of values without scaling.
+std::vector<double> decode_jpeg2000_values(const std::byte* buf, size_t raw_data_length, size_t data_count);
+
+// decode codes and write scaled values (reference_value + code * 2^binary_scale_factor) / 10^decimal_scale_factor
+// into values directly. size of values is count of values to decode.
+bool decode_jpeg2000_values(const std::byte* buf, size_t raw_data_length, gsl::span<double> values,
+                            float reference_value, int binary_scale_factor, int decimal_scale_factor);
+bool decode_jpeg2000_values(const std::byte* buf, size_t raw_data_length, gsl::span<float> values,
+                            float reference_value, int binary_scale_factor, int decimal_scale_factor);
 
 bool encode_jpeg2000_values(j2k_encode_helper* helper);
 
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <gsl/span>
+
+#include <cstdint>
+
+namespace grib_coder {
+
+// reference value and scale factors of data representation template, used to restore values from codes:
+//
+//      value = (reference_value + code * 2^binary_scale_factor) / 10^decimal_scale_factor
+struct PackingScale {
+    PackingScale(float reference_value, int binary_scale_factor, int decimal_scale_factor);
+
+    double reference_value = 0;
+    double binary_scale = 1;
+    double decimal_scale = 1;
+};
+
+// mask codes and write scaled values in one pass. count of codes is size of values.
+// kernel is selected by cpu at runtime (AVX-512, AVX2, SSE2 or plain loop), and all kernels give the same values.
+void scale_packed_codes(const int32_t* codes, uint32_t mask, const PackingScale& scale, gsl::span<double> values);
+void scale_packed_codes(const int32_t* codes, uint32_t mask, const PackingScale& scale, gsl::span<float> values);
+
+} // namespace grib_coder
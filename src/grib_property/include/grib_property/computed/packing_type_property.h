@@ -5,12 +5,13 @@ namespace grib_coder {
 class PackingTypeProperty : public ComputedProperty {
 public:
     std::string getString() override {
+        computeIfNeeded();
         return packing_type_;
     }
 
-    bool decode(GribMessageHandler* handler) override;
-
 private:
+    bool compute(GribMessageHandler* handler) override;
+
     void encodeToComponents() override;
 
     std::string packing_type_ = "MISSING";
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <grib_property/computed/packed_values_scaler.h>
+
+#include <gsl/span>
+
+#include <cstddef>
+
+namespace grib_coder {
+
+// decode values of simple packing (data representation template 5.0), which stores codes of bits_per_value bits
+// one after another from the most significant bit. count of values is size of values.
+// values of a constant field (bits_per_value is 0) are all reference_value / 10^decimal_scale_factor.
+// return false if bits_per_value is not in 0 - 32 or bytes are too short.
+bool decode_simple_packing_values(gsl::span<const std::byte> bytes, int bits_per_value,
+                                  const PackingScale& scale, gsl::span<double> values);
+bool decode_simple_packing_values(gsl::span<const std::byte> bytes, int bits_per_value,
+                                  const PackingScale& scale, gsl::span<float> values);
+
+} // namespace grib_coder
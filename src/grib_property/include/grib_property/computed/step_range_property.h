@@ -8,9 +8,9 @@ class StepRangeProperty : public ComputedProperty {
 public:
     std::string getString() override;
 
-    bool decode(GribMessageHandler* handler) override;
-
 private:
+    bool compute(GribMessageHandler* handler) override;
+
     void encodeToComponents() override;
 
     long start_ = -1;
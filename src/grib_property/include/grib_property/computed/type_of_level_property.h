@@ -7,9 +7,9 @@ class TypeOfLevelProperty : public ComputedProperty {
 public:
     std::string getString() override;
 
-    bool decode(GribMessageHandler* handler) override;
-
 private:
+    bool compute(GribMessageHandler* handler) override;
+
     void encodeToComponents() override;
 
     std::string type_of_level_ = "MISSING";
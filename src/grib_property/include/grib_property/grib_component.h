@@ -11,7 +11,7 @@ public:
     virtual long getByteCount() const = 0;
 
     // parse binary bytes read from grib message.
-    virtual bool parse(std::vector<std::byte>::const_iterator& iterator);
+    virtual bool parse(const std::byte*& iterator);
 
     // decode component using previous sections, such as
     //  - computed properties
@@ -27,7 +27,7 @@ public:
     virtual void setDoubleArray(std::vector<double>& values);
     virtual std::vector<double> getDoubleArray();
 
-    virtual bool parse(std::vector<std::byte>::const_iterator& iterator, size_t count);
+    virtual bool parse(const std::byte*& iterator, size_t count);
 
     virtual bool decode(GribMessageHandler* handler);
 
@@ -1,6 +1,7 @@
 #pragma once
 #include <map>
 #include <memory>
+#include <mutex>
 
 #include <grib_property/grib_table.h>
 
@@ -17,6 +18,8 @@ private:
 
     // table_version.table_id
     std::map<std::string, std::shared_ptr<GribTable>> tables_;
+    // database may be shared by message handlers decoded in several threads.
+    std::mutex mutex_;
     std::string eccodes_definition_path_;
 };
 
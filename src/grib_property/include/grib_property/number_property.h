@@ -24,6 +24,11 @@ public:
         return value_;
     }
 
+    // set value without virtual call, used by decoders of fixed layouts.
+    void setValue(T value) {
+        value_ = value;
+    }
+
     void setLong(long value) override {
         value_ = static_cast<T>(value);
     }
@@ -49,7 +54,7 @@ public:
         return fmt::format("{}", value_);
     }
 
-    bool parse(std::vector<std::byte>::const_iterator& iterator, size_t count = sizeof(T)) override {
+    bool parse(const std::byte*& iterator, size_t count = sizeof(T)) override {
         value_ = convert_bytes_to_number<T>(&(*iterator));
         return true;
     }
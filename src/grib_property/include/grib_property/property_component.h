@@ -15,9 +15,9 @@ public:
     }
 
     GribProperty* getProperty();
-    std::string getPropertyName() const;
+    const std::string& getPropertyName() const;
 
-    bool parse(std::vector<std::byte>::const_iterator& iterator) override;
+    bool parse(const std::byte*& iterator) override;
 
     bool decode(GribMessageHandler* handler) override;
 
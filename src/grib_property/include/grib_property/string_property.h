@@ -10,10 +10,15 @@ public:
         length_ = length;
     };
 
+    // set value without virtual call, used by decoders of fixed layouts.
+    void setValue(const char* value, size_t length) {
+        value_.assign(value, length);
+    }
+
     void setString(const std::string& value) override;
     std::string getString() override;
 
-    bool parse(std::vector<std::byte>::const_iterator& iterator, size_t count) override;
+    bool parse(const std::byte*& iterator, size_t count) override;
 
     void dump(const DumpConfig& dump_config) override;
 
@@ -92,7 +92,7 @@ void CodeTableProperty::setByteCount(size_t count) {
     byte_count_ = count;
 }
 
-bool CodeTableProperty::parse(std::vector<std::byte>::const_iterator& iterator, size_t count) {
+bool CodeTableProperty::parse(const std::byte*& iterator, size_t count) {
     if (count == 1) {
         value_ = convert_bytes_to_number<uint8_t>(&(*iterator));
     } else if (count == 2) {
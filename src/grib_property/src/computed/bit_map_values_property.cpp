@@ -6,15 +6,21 @@ namespace grib_coder {
 void BitMapValuesProperty::setRawValues(std::vector<std::byte>&& raw_values)
 {
     raw_bytes_ = std::move(raw_values);
+    raw_bytes_view_ = raw_bytes_;
+}
+
+void BitMapValuesProperty::setRawValuesView(gsl::span<const std::byte> raw_values) {
+    raw_bytes_.clear();
+    raw_bytes_view_ = raw_values;
 }
 
 bool BitMapValuesProperty::decodeValues(GribMessageHandler* container) {
     auto count = container->getLong("numberOfDataPoints");
-    values_.resize(raw_bytes_.size() * 8);
+    values_.resize(raw_bytes_view_.size() * 8);
     auto iter = std::begin(values_);
-    for(auto byte: raw_bytes_) {
+    for(auto byte: raw_bytes_view_) {
         for(auto i=0; i<8; i++) {
-            *iter = static_cast<bool>(byte >> (7 - std::to_integer<uint8_t>(byte)));
+            *iter = ((std::to_integer<uint8_t>(byte) >> (7 - i)) & 1) != 0;
             ++iter;
         }
     }
@@ -4,6 +4,7 @@ namespace grib_coder {
 
 bool ComputedProperty::decode(GribMessageHandler* handler) {
     message_handler_ = handler;
+    computed_ = false;
     return true;
 }
 } // namespace
\ No newline at end of file
@@ -8,6 +8,7 @@
 namespace grib_coder {
 
 void DataDateProperty::setLong(long value) {
+    computed_ = true;
     year_ = static_cast<int>(std::floor(value / 10000));
     const auto month_day = value % 10000;
     month_ = static_cast<int>(std::floor(month_day / 100));
@@ -17,6 +18,7 @@ void DataDateProperty::setLong(long value) {
 }
 
 long DataDateProperty::getLong() {
+    computeIfNeeded();
     // YYYYMMDD
     return year_ * 10000 + month_ * 100 + day_;
 }
@@ -31,6 +33,7 @@ double DataDateProperty::getDouble() {
 }
 
 void DataDateProperty::setString(const std::string& value) {
+    computed_ = true;
     // YYYY-MM-DD
     year_ = std::stoi(value.substr(0, 4));
     month_ = std::stoi(value.substr(5, 2));
@@ -40,6 +43,7 @@ void DataDateProperty::setString(const std::string& value) {
 }
 
 std::string DataDateProperty::getString() {
+    computeIfNeeded();
     // YYYY-MM-DD
     return fmt::format("{year:04}-{month:02}-{day:02}",
                        fmt::arg("year", year_),
@@ -47,11 +51,10 @@ std::string DataDateProperty::getString() {
                        fmt::arg("day", day_));
 }
 
-bool DataDateProperty::decode(GribMessageHandler* handler) {
+bool DataDateProperty::compute(GribMessageHandler* handler) {
     year_ = static_cast<int>(handler->getLong("year"));
     month_ = static_cast<int>(handler->getLong("month"));
     day_ = static_cast<int>(handler->getLong("day"));
-    ComputedProperty::decode(handler);
     return true;
 }
 
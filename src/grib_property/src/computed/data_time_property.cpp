@@ -7,6 +7,7 @@
 
 namespace grib_coder {
 void DataTimeProperty::setLong(long value) {
+    computed_ = true;
     hour_ = static_cast<int>(std::floor(value / 100));
     minute_ = value % 100;
     second_ = 0;
@@ -15,6 +16,7 @@ void DataTimeProperty::setLong(long value) {
 }
 
 long DataTimeProperty::getLong() {
+    computeIfNeeded();
     if (hour_ == 255) {
         return 0;
     }
@@ -35,6 +37,7 @@ double DataTimeProperty::getDouble() {
 }
 
 void DataTimeProperty::setString(const std::string& value) {
+    computed_ = true;
     // HH:MM
     hour_ = std::stoi(value.substr(0, 2));
     minute_ = std::stoi(value.substr(3, 2));
@@ -42,6 +45,7 @@ void DataTimeProperty::setString(const std::string& value) {
 }
 
 std::string DataTimeProperty::getString() {
+    computeIfNeeded();
     if (hour_ == 255) {
         return "00:00";
     }
@@ -53,8 +57,7 @@ std::string DataTimeProperty::getString() {
     return fmt::format("{hour:02}:{minute:02}", fmt::arg("hour", hour_), fmt::arg("minute", minute_));;
 }
 
-bool DataTimeProperty::decode(GribMessageHandler* container) {
-    message_handler_ = container;
+bool DataTimeProperty::compute(GribMessageHandler* container) {
     hour_ = container->getLong("hour");
     minute_ = container->getLong("minute");
     second_ = container->getLong("second");
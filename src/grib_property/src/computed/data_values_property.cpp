@@ -1,6 +1,7 @@
 #include "grib_property/computed/data_values_property.h"
 #include <grib_coder/grib_message_handler.h>
 #include "grib_property/computed/openjpeg_decoder.h"
+#include "grib_property/computed/simple_packing_decoder.h"
 #include <grib_property/computed/bit_map_values_property.h>
 
 #include <fmt/format.h>
@@ -11,6 +12,30 @@
 
 namespace grib_coder {
 
+namespace {
+
+const KeyId binary_scale_factor_key{"binaryScaleFactor"};
+const KeyId decimal_scale_factor_key{"decimalScaleFactor"};
+const KeyId reference_value_key{"referenceValue"};
+const KeyId bits_per_value_key{"bitsPerValue"};
+const KeyId bit_map_indicator_key{"bitMapIndicator"};
+const KeyId number_of_values_key{"numberOfValues"};
+const KeyId bitmap_key{"bitmap"};
+const KeyId data_representation_template_number_key{"dataRepresentationTemplateNumber"};
+
+// data representation template 5.0, other templates are decoded as JPEG 2000 (template 5.40).
+const long simple_packing_template_number = 0;
+
+// all codes of a constant field are 0, so each value is (R + 0 * 2^E) / 10^D, the same as simple packing
+// with 0 bits per value.
+double get_constant_field_value(GribMessageHandler* container) {
+    const auto reference_value = static_cast<float>(container->getDouble(reference_value_key));
+    const auto decimal_scale_factor = static_cast<int>(container->getLong(decimal_scale_factor_key));
+    return reference_value / std::pow(10, decimal_scale_factor);
+}
+
+} // namespace
+
 void DataValuesProperty::setDoubleArray(std::vector<double>& values) {
     values_ = values;
 }
@@ -19,40 +44,108 @@ std::vector<double> DataValuesProperty::getDoubleArray() {
     return values_;
 }
 
+bool DataValuesProperty::getValues(gsl::span<double> values) const {
+    if (data_count_ == -1 || values.size() != values_.size()) {
+        return false;
+    }
+    std::copy(std::begin(values_), std::end(values_), std::begin(values));
+    return true;
+}
+
+bool DataValuesProperty::getValues(gsl::span<float> values) const {
+    if (data_count_ == -1 || values.size() != values_.size()) {
+        return false;
+    }
+    std::transform(std::begin(values_), std::end(values_), std::begin(values), [](double value) {
+        return static_cast<float>(value);
+    });
+    return true;
+}
+
 void DataValuesProperty::setRawValues(std::vector<std::byte>&& raw_values) {
     raw_value_bytes_ = std::move(raw_values);
+    raw_value_view_ = raw_value_bytes_;
+}
+
+void DataValuesProperty::setRawValuesView(gsl::span<const std::byte> raw_values) {
+    raw_value_bytes_.clear();
+    raw_value_view_ = raw_values;
+
+    // values decoded from previous bytes are not valid.
+    data_count_ = -1;
+    values_.clear();
+}
+
+void DataValuesProperty::releaseRawValues() {
+    std::vector<std::byte>{}.swap(raw_value_bytes_);
+    raw_value_view_ = {};
 }
 
 bool DataValuesProperty::decodeValues(GribMessageHandler* container) {
     // constant field has no data values
-    if (raw_value_bytes_.empty()) {
+    if (raw_value_view_.empty()) {
         return decodeConstantFields(container);
     } else {
         return decodeNormalFields(container);
     }
 }
 
+bool DataValuesProperty::decodeValues(GribMessageHandler* container, gsl::span<double> values) {
+    return decodeValuesInto(container, values);
+}
+
+bool DataValuesProperty::decodeValues(GribMessageHandler* container, gsl::span<float> values) {
+    return decodeValuesInto(container, values);
+}
+
+template <typename T>
+bool DataValuesProperty::decodeValuesInto(GribMessageHandler* container, gsl::span<T> values) {
+    // constant field has no data values, and bitmap is not used as in decodeConstantFields.
+    if (raw_value_view_.empty()) {
+        if (static_cast<long>(values.size()) != container->getLong(number_of_values_key)) {
+            return false;
+        }
+        std::fill(std::begin(values), std::end(values), static_cast<T>(get_constant_field_value(container)));
+        return true;
+    }
+
+    if (container->getLong(bit_map_indicator_key) != 255) {
+        return decodeBitmapValues(container, values);
+    }
+
+    if (static_cast<long>(values.size()) != container->getLong(number_of_values_key)) {
+        return false;
+    }
+    return decodePackedValues(container, values);
+}
+
 void DataValuesProperty::dump(const DumpConfig& dump_config) {
     if (data_count_ == -1) {
         fmt::print("not decode");
     } else if (data_count_ == 0) {
         fmt::print("empty");
     } else {
-        fmt::print("({}, {})", data_count_, raw_value_bytes_.size());
+        fmt::print("({}, {})", data_count_, raw_value_view_.size());
     }
 }
 
 bool DataValuesProperty::encodeValues(GribMessageHandler* container) {
 
     // currently we don't support bitmap.
-    const auto bit_map_indicator = static_cast<uint8_t>(container->getLong("bitMapIndicator"));
+    const auto bit_map_indicator = static_cast<uint8_t>(container->getLong(bit_map_indicator_key));
     if (bit_map_indicator != std::numeric_limits<uint8_t>::max()) {
         throw std::runtime_error("bit map is not supported");
     }
 
+    // values are always encoded as JPEG 2000 code stream.
+    if (container->getLong(data_representation_template_number_key) == simple_packing_template_number) {
+        throw std::runtime_error("encoding simple packing is not supported");
+    }
+
     calculate(container);
 
     raw_value_bytes_.clear();
+    raw_value_view_ = {};
 
     if (data_count_ == 0) {
         return encodeConstantFields(container);
@@ -62,15 +155,15 @@ bool DataValuesProperty::encodeValues(GribMessageHandler* container) {
 }
 
 void DataValuesProperty::pack(std::back_insert_iterator<std::vector<std::byte>>& iterator) {
-    std::copy(std::begin(raw_value_bytes_), std::end(raw_value_bytes_), iterator);
+    std::copy(std::begin(raw_value_view_), std::end(raw_value_view_), iterator);
 }
 
 // algorithm is from NCEP wgrib2 (grib2/g2clib-1.4.0/jpcpack.c)
 void DataValuesProperty::calculate(GribMessageHandler* container) {
-    const auto binary_scale_factor = static_cast<int>(container->getLong("binaryScaleFactor"));
-    const auto decimal_scale_factor = static_cast<int>(container->getLong("decimalScaleFactor"));
-    const auto old_reference_value = static_cast<float>(container->getDouble("referenceValue"));
-    const auto old_bits_per_value = static_cast<int>(container->getLong("bitsPerValue"));
+    const auto binary_scale_factor = static_cast<int>(container->getLong(binary_scale_factor_key));
+    const auto decimal_scale_factor = static_cast<int>(container->getLong(decimal_scale_factor_key));
+    const auto old_reference_value = static_cast<float>(container->getDouble(reference_value_key));
+    const auto old_bits_per_value = static_cast<int>(container->getLong(bits_per_value_key));
 
     const auto binary_scale = std::pow(2, -1 * binary_scale_factor);
     const auto decimal_scale = std::pow(10, decimal_scale_factor);
@@ -99,71 +192,108 @@ void DataValuesProperty::calculate(GribMessageHandler* container) {
     } else {
         data_count_ = 0;
         bits_per_value = 0;
-        reference_value = *min_value_iter;
+        reference_value = static_cast<float>(*min_value_iter * decimal_scale);
     }
 
-    container->setDouble("referenceValue", reference_value);
-    container->setLong("bitsPerValue", bits_per_value);
+    container->setDouble(reference_value_key, reference_value);
+    container->setLong(bits_per_value_key, bits_per_value);
 }
 
 bool DataValuesProperty::decodeConstantFields(GribMessageHandler* container) {
-    data_count_ = container->getLong("numberOfValues");
-    const auto reference_value = static_cast<float>(container->getDouble("referenceValue"));
+    data_count_ = container->getLong(number_of_values_key);
 
     values_.resize(data_count_);
-    std::fill(std::begin(values_), std::end(values_), reference_value);
+    std::fill(std::begin(values_), std::end(values_), get_constant_field_value(container));
 
     return true;
 }
 
+template <typename T>
+bool DataValuesProperty::decodePackedValues(GribMessageHandler* container, gsl::span<T> values) {
+    const auto binary_scale_factor = int(container->getLong(binary_scale_factor_key));
+    const auto decimal_scale_factor = int(container->getLong(decimal_scale_factor_key));
+    const auto reference_value = float(container->getDouble(reference_value_key));
+
+    if (container->getLong(data_representation_template_number_key) == simple_packing_template_number) {
+        const auto bits_per_value = int(container->getLong(bits_per_value_key));
+        return decode_simple_packing_values(raw_value_view_, bits_per_value,
+                                            PackingScale{reference_value, binary_scale_factor, decimal_scale_factor},
+                                            values);
+    }
+
+    return decode_jpeg2000_values(raw_value_view_.data(), raw_value_view_.size(), values,
+                                  reference_value, binary_scale_factor, decimal_scale_factor);
+}
+
 bool DataValuesProperty::decodeNormalFields(GribMessageHandler* container) {
-    const auto binary_scale_factor = int(container->getLong("binaryScaleFactor"));
-    const auto decimal_scale_factor = int(container->getLong("decimalScaleFactor"));
-    const auto reference_value = float(container->getDouble("referenceValue"));
-    const auto bit_map_indicator = int(container->getLong("bitMapIndicator"));
-
-    data_count_ = container->getLong("numberOfValues");
-    codes_values_ = decode_jpeg2000_values(&raw_value_bytes_[0], raw_value_bytes_.size(), data_count_);
-    std::transform(codes_values_.begin(), codes_values_.end(), codes_values_.begin(), [=](double v) {
-        return (reference_value + v * std::pow(2, binary_scale_factor)) / std::pow(10, decimal_scale_factor);
-    });
+    const auto bit_map_indicator = int(container->getLong(bit_map_indicator_key));
+
+    data_count_ = container->getLong(number_of_values_key);
 
-   
     if(bit_map_indicator == 255) {
-        values_ = codes_values_;
-    } else {
-        const auto bitmap_property = container->getProperty("bitmap");
-        const auto bitmap = dynamic_cast<const BitMapValuesProperty*>(bitmap_property);
-        auto bitmap_values = bitmap->getValues();
-
-        const auto missing_value = container->getMissingValue();
-
-        const auto data_values_count = bitmap_values.size();
-        values_.resize(data_values_count);
-
-        auto data_iter = std::begin(values_);
-        auto codes_iter = std::begin(codes_values_);
-        for(auto bit: bitmap_values) {
-            if(bit) {
-                *data_iter = *codes_iter;
-                ++codes_iter;
-            } else {
-                *data_iter = missing_value;
-            }
-            ++data_iter;
+        values_.resize(data_count_);
+        if (!decodePackedValues(container, gsl::make_span(values_))) {
+            // values are empty if packed values can't be decoded.
+            values_.clear();
+        }
+        return true;
+    }
+
+    const auto bitmap = dynamic_cast<const BitMapValuesProperty*>(container->getProperty(bitmap_key));
+    values_.resize(bitmap->getValues().size());
+    if (!decodeBitmapValues(container, gsl::make_span(values_))) {
+        values_.clear();
+    }
+    return true;
+}
+
+template <typename T>
+bool DataValuesProperty::decodeBitmapValues(GribMessageHandler* container, gsl::span<T> values) {
+    const auto bitmap = dynamic_cast<const BitMapValuesProperty*>(container->getProperty(bitmap_key));
+    const auto& bitmap_values = bitmap->getValues();
+    const auto data_count = container->getLong(number_of_values_key);
+
+    // each point set in bitmap takes one packed value. A corrupt bitmap with other count of set points
+    // would read codes beyond values.
+    const auto set_count = std::count(std::begin(bitmap_values), std::end(bitmap_values), true);
+    if (values.size() != bitmap_values.size() || data_count < 0 || set_count != data_count) {
+        return false;
+    }
+
+    // decode values into the end of values, and move them forward to points set in bitmap.
+    // since count of set points equals count of codes, a value is always read before its slot is written,
+    // so no other buffer is needed.
+    const auto codes_begin = values.size() - data_count;
+    if (!decodePackedValues(container, values.subspan(codes_begin))) {
+        return false;
+    }
+
+    const auto missing_value = static_cast<T>(container->getMissingValue());
+    auto data_iter = std::begin(values);
+    auto codes_iter = std::begin(values) + codes_begin;
+    for(auto bit: bitmap_values) {
+        if(bit) {
+            *data_iter = *codes_iter;
+            ++codes_iter;
+        } else {
+            *data_iter = missing_value;
         }
+        ++data_iter;
     }
 
     return true;
 }
 
 bool DataValuesProperty::encodeConstantFields(GribMessageHandler* container) {
-    const auto reference_value = values_[0];
+    // inverse of get_constant_field_value.
+    const auto decimal_scale_factor = static_cast<int>(container->getLong(decimal_scale_factor_key));
+    const auto reference_value = values_[0] * std::pow(10, decimal_scale_factor);
     const auto bits_per_value = 0;
-    container->setDouble("referenceValue", reference_value);
-    container->setLong("bitsPerValue", bits_per_value);
+    container->setDouble(reference_value_key, reference_value);
+    container->setLong(bits_per_value_key, bits_per_value);
 
     raw_value_bytes_.clear();
+    raw_value_view_ = {};
     data_count_ = 0;
 
     return true;
@@ -172,10 +302,10 @@ bool DataValuesProperty::encodeConstantFields(GribMessageHandler* container) {
 bool DataValuesProperty::encodeNormalFields(GribMessageHandler* container) {
     const auto ni = container->getLong("ni");
     const auto nj = container->getLong("nj");
-    const auto binary_scale_factor = static_cast<int>(container->getLong("binaryScaleFactor"));
-    const auto decimal_scale_factor = static_cast<int>(container->getLong("decimalScaleFactor"));
-    const auto reference_value = static_cast<float>(container->getDouble("referenceValue"));
-    const auto bits_per_value = static_cast<int>(container->getLong("bitsPerValue"));
+    const auto binary_scale_factor = static_cast<int>(container->getLong(binary_scale_factor_key));
+    const auto decimal_scale_factor = static_cast<int>(container->getLong(decimal_scale_factor_key));
+    const auto reference_value = static_cast<float>(container->getDouble(reference_value_key));
+    const auto bits_per_value = static_cast<int>(container->getLong(bits_per_value_key));
 
     auto helper = std::make_unique<j2k_encode_helper>();
 
@@ -208,6 +338,7 @@ bool DataValuesProperty::encodeNormalFields(GribMessageHandler* container) {
     raw_value_bytes_.resize(encoded_length);
     std::transform(std::begin(buffer), std::begin(buffer) + encoded_length, std::begin(raw_value_bytes_),
         [](unsigned char c) -> std::byte { return static_cast<std::byte>(c); });
+    raw_value_view_ = raw_value_bytes_;
 
     return true;
 }
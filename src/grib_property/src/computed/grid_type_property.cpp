@@ -33,7 +33,9 @@ const std::vector<
     },
 };
 
-bool GridTypeProperty::decode(GribMessageHandler* handler) {
+bool GridTypeProperty::compute(GribMessageHandler* handler) {
+    grid_type_ = "MISSING";
+
     std::map<std::string, long> property_map;
 
     property_map["gridDefinitionTemplateNumber"] = handler->getLong("gridDefinitionTemplateNumber");
@@ -62,7 +64,6 @@ bool GridTypeProperty::decode(GribMessageHandler* handler) {
             break;
         }
     }
-    ComputedProperty::decode(handler);
     return true;
 }
 
@@ -8,6 +8,7 @@
 
 namespace grib_coder {
 std::string LevelProperty::getString() {
+    computeIfNeeded();
     if (value_ == std::numeric_limits<double>::max()) {
         return "MISSING";
     }
@@ -15,7 +16,9 @@ std::string LevelProperty::getString() {
     return fmt::format("{}", value_);
 }
 
-bool LevelProperty::decode(GribMessageHandler* handler) {
+bool LevelProperty::compute(GribMessageHandler* handler) {
+    value_ = std::numeric_limits<double>::max();
+
     const auto level_number_factor = handler->getLong("scaleFactorOfFirstFixedSurface");
     const auto level_number_value = handler->getLong("scaledValueOfFirstFixedSurface");
     const auto type_of_first_fixed_surface = handler->getLong("typeOfFirstFixedSurface");
@@ -32,7 +35,6 @@ bool LevelProperty::decode(GribMessageHandler* handler) {
     }
 
     value_ = std::pow(10, level_number_factor) * level_number_value;
-    ComputedProperty::decode(handler);
     return true;
 }
 
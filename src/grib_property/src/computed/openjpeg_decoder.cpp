@@ -1,5 +1,6 @@
 #include "grib_property/computed/openjpeg_decoder.h"
 #include "grib_property/computed/openjpeg_helper.h"
+#include "grib_property/computed/packed_values_scaler.h"
 
 #include <cassert>
 
@@ -15,10 +16,15 @@ void openjpeg_info(const char* msg, void* client_data) {
 
 namespace grib_coder {
 
-std::vector<double> decode_jpeg2000_values(std::byte* buf, size_t raw_data_length, size_t data_count) {
+namespace {
+
+// values of double or float, scaled by the kernel of the same type.
+template <typename T>
+bool decode_scaled_values(const std::byte* buf, size_t raw_data_length, gsl::span<T> values,
+                          float reference_value, int binary_scale_factor, int decimal_scale_factor) {
     int err = 0;
     unsigned long mask;
-    std::vector<double> val;
+    const auto data_count = values.size();
 
     opj_dparameters_t parameters = {0,}; /* decompression parameters */
     opj_stream_t* stream = nullptr;
@@ -40,7 +46,7 @@ std::vector<double> decode_jpeg2000_values(std::byte* buf, size_t raw_data_lengt
     opj_set_error_handler(codec, openjpeg_error, nullptr);
 
     /* initialize our memory stream */
-    mstream.pData = reinterpret_cast<unsigned char*>(buf);
+    mstream.pData = reinterpret_cast<unsigned char*>(const_cast<std::byte*>(buf));
     mstream.dataSize = raw_data_length;
     mstream.offset = 0;
     /* open a byte stream from memory stream */
@@ -79,13 +85,9 @@ std::vector<double> decode_jpeg2000_values(std::byte* buf, size_t raw_data_lengt
         auto data = image->comps[0].data;
         mask = (1 << image->comps[0].prec) - 1;
 
-        auto count = image->comps[0].w * image->comps[0].h;
-
-        val.resize(count);
-        for (auto i = 0; i < count; i++) {
-            auto v = data[i];
-            val[i] = v & mask;
-        }
+        // scale codes when they are copied out of image, without a buffer of codes.
+        scale_packed_codes(data, static_cast<uint32_t>(mask),
+                           PackingScale{reference_value, binary_scale_factor, decimal_scale_factor}, values);
 
         if (!opj_end_decompress(codec, stream)) {
             err = 7;
@@ -99,9 +101,29 @@ cleanup:
     if (stream) opj_stream_destroy(stream);
     if (image) opj_image_destroy(image);
 
+    return err == 0;
+}
+
+} // namespace
+
+std::vector<double> decode_jpeg2000_values(const std::byte* buf, size_t raw_data_length, size_t data_count) {
+    std::vector<double> val(data_count);
+    if (!decode_jpeg2000_values(buf, raw_data_length, gsl::make_span(val), 0, 0, 0)) {
+        val.clear();
+    }
     return val;
 }
 
+bool decode_jpeg2000_values(const std::byte* buf, size_t raw_data_length, gsl::span<double> values,
+                            float reference_value, int binary_scale_factor, int decimal_scale_factor) {
+    return decode_scaled_values(buf, raw_data_length, values, reference_value, binary_scale_factor, decimal_scale_factor);
+}
+
+bool decode_jpeg2000_values(const std::byte* buf, size_t raw_data_length, gsl::span<float> values,
+                            float reference_value, int binary_scale_factor, int decimal_scale_factor) {
+    return decode_scaled_values(buf, raw_data_length, values, reference_value, binary_scale_factor, decimal_scale_factor);
+}
+
 bool encode_jpeg2000_values(j2k_encode_helper* helper) {
     auto flag = true;
     const int numcomps = 1;
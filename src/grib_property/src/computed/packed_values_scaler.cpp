@@ -0,0 +1,221 @@
+#include "grib_property/computed/packed_values_scaler.h"
+
+#include <cmath>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GRIB_PROPERTY_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace grib_coder {
+
+namespace {
+
+enum class ScaleKernel {
+    Plain,
+    Sse2,
+    Avx2,
+    Avx512,
+};
+
+ScaleKernel select_scale_kernel() {
+#ifdef GRIB_PROPERTY_X86_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return ScaleKernel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return ScaleKernel::Avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return ScaleKernel::Sse2;
+    }
+#endif
+    return ScaleKernel::Plain;
+}
+
+ScaleKernel get_scale_kernel() {
+    static const auto kernel = select_scale_kernel();
+    return kernel;
+}
+
+// scale codes from begin to count one by one, used for all codes without SIMD and for tails of SIMD kernels.
+template <typename T>
+void scale_codes_plain(const int32_t* codes, size_t begin, size_t count, uint32_t mask, const PackingScale& scale, T* values) {
+    for (auto i = begin; i < count; i++) {
+        const auto code = static_cast<double>(static_cast<uint32_t>(codes[i]) & mask);
+        values[i] = static_cast<T>((scale.reference_value + code * scale.binary_scale) / scale.decimal_scale);
+    }
+}
+
+#ifdef GRIB_PROPERTY_X86_KERNELS
+
+// Each kernel scales codes in blocks and returns count of scaled codes, the rest is left to scale_codes_plain.
+// Multiply, add and divide are done separately in double as scale_codes_plain does, so values don't depend
+// on the kernel. Division is skipped when decimal scale is 1, which doesn't change values.
+
+__attribute__((target("sse2")))
+inline void store_sse2(double* values, __m128d low, __m128d high) {
+    _mm_storeu_pd(values, low);
+    _mm_storeu_pd(values + 2, high);
+}
+
+__attribute__((target("sse2")))
+inline void store_sse2(float* values, __m128d low, __m128d high) {
+    _mm_storeu_ps(values, _mm_movelh_ps(_mm_cvtpd_ps(low), _mm_cvtpd_ps(high)));
+}
+
+template <typename T>
+__attribute__((target("sse2")))
+size_t scale_codes_sse2(const int32_t* codes, size_t count, uint32_t mask, const PackingScale& scale, T* values) {
+    const auto mask_vector = _mm_set1_epi32(static_cast<int32_t>(mask));
+    const auto reference_vector = _mm_set1_pd(scale.reference_value);
+    const auto binary_vector = _mm_set1_pd(scale.binary_scale);
+    const auto decimal_vector = _mm_set1_pd(scale.decimal_scale);
+    const auto need_divide = scale.decimal_scale != 1;
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const auto code = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(codes + i)), mask_vector);
+        auto low = _mm_add_pd(reference_vector, _mm_mul_pd(_mm_cvtepi32_pd(code), binary_vector));
+        auto high = _mm_add_pd(
+            reference_vector, _mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(code, _MM_SHUFFLE(1, 0, 3, 2))), binary_vector));
+        if (need_divide) {
+            low = _mm_div_pd(low, decimal_vector);
+            high = _mm_div_pd(high, decimal_vector);
+        }
+        store_sse2(values + i, low, high);
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+inline void store_avx2(double* values, __m256d value) {
+    _mm256_storeu_pd(values, value);
+}
+
+__attribute__((target("avx2")))
+inline void store_avx2(float* values, __m256d value) {
+    _mm_storeu_ps(values, _mm256_cvtpd_ps(value));
+}
+
+template <typename T>
+__attribute__((target("avx2")))
+size_t scale_codes_avx2(const int32_t* codes, size_t count, uint32_t mask, const PackingScale& scale, T* values) {
+    const auto mask_vector = _mm256_set1_epi32(static_cast<int32_t>(mask));
+    const auto reference_vector = _mm256_set1_pd(scale.reference_value);
+    const auto binary_vector = _mm256_set1_pd(scale.binary_scale);
+    const auto decimal_vector = _mm256_set1_pd(scale.decimal_scale);
+    const auto need_divide = scale.decimal_scale != 1;
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto code = _mm256_and_si256(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(codes + i)), mask_vector);
+        auto low = _mm256_add_pd(
+            reference_vector, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(code)), binary_vector));
+        auto high = _mm256_add_pd(
+            reference_vector, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(code, 1)), binary_vector));
+        if (need_divide) {
+            low = _mm256_div_pd(low, decimal_vector);
+            high = _mm256_div_pd(high, decimal_vector);
+        }
+        store_avx2(values + i, low);
+        store_avx2(values + i + 4, high);
+    }
+    return i;
+}
+
+// intrinsics of AVX-512 in GCC 12 headers start from undefined vectors, which triggers false warnings.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+__attribute__((target("avx512f")))
+inline void store_avx512(double* values, __m512d value) {
+    _mm512_storeu_pd(values, value);
+}
+
+__attribute__((target("avx512f")))
+inline void store_avx512(float* values, __m512d value) {
+    _mm256_storeu_ps(values, _mm512_cvtpd_ps(value));
+}
+
+// AVX-512 implies FMA, so multiply uses explicit rounding to keep compiler from fusing it with add.
+__attribute__((target("avx512f")))
+inline __m512d scale_avx512(__m256i code, __m512d reference_vector, __m512d binary_vector) {
+    return _mm512_add_pd(
+        reference_vector,
+        _mm512_mul_round_pd(_mm512_cvtepi32_pd(code), binary_vector, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+}
+
+template <typename T>
+__attribute__((target("avx512f")))
+size_t scale_codes_avx512(const int32_t* codes, size_t count, uint32_t mask, const PackingScale& scale, T* values) {
+    const auto mask_vector = _mm512_set1_epi32(static_cast<int32_t>(mask));
+    const auto reference_vector = _mm512_set1_pd(scale.reference_value);
+    const auto binary_vector = _mm512_set1_pd(scale.binary_scale);
+    const auto decimal_vector = _mm512_set1_pd(scale.decimal_scale);
+    const auto need_divide = scale.decimal_scale != 1;
+
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        const auto code = _mm512_and_si512(_mm512_loadu_si512(codes + i), mask_vector);
+        auto low = scale_avx512(_mm512_castsi512_si256(code), reference_vector, binary_vector);
+        auto high = scale_avx512(_mm512_extracti64x4_epi64(code, 1), reference_vector, binary_vector);
+        if (need_divide) {
+            low = _mm512_div_pd(low, decimal_vector);
+            high = _mm512_div_pd(high, decimal_vector);
+        }
+        store_avx512(values + i, low);
+        store_avx512(values + i + 8, high);
+    }
+    return i;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+template <typename T>
+void scale_codes(const int32_t* codes, uint32_t mask, const PackingScale& scale, gsl::span<T> values) {
+    const auto count = values.size();
+    size_t scaled_count = 0;
+#ifdef GRIB_PROPERTY_X86_KERNELS
+    switch (get_scale_kernel()) {
+        case ScaleKernel::Avx512:
+            scaled_count = scale_codes_avx512(codes, count, mask, scale, values.data());
+            break;
+        case ScaleKernel::Avx2:
+            scaled_count = scale_codes_avx2(codes, count, mask, scale, values.data());
+            break;
+        case ScaleKernel::Sse2:
+            scaled_count = scale_codes_sse2(codes, count, mask, scale, values.data());
+            break;
+        default:
+            break;
+    }
+#endif
+    scale_codes_plain(codes, scaled_count, count, mask, scale, values.data());
+}
+
+} // namespace
+
+PackingScale::PackingScale(float reference_value, int binary_scale_factor, int decimal_scale_factor):
+    reference_value{reference_value},
+    binary_scale{std::pow(2, binary_scale_factor)},
+    decimal_scale{std::pow(10, decimal_scale_factor)} {
+}
+
+void scale_packed_codes(const int32_t* codes, uint32_t mask, const PackingScale& scale, gsl::span<double> values) {
+    scale_codes(codes, mask, scale, values);
+}
+
+void scale_packed_codes(const int32_t* codes, uint32_t mask, const PackingScale& scale, gsl::span<float> values) {
+    scale_codes(codes, mask, scale, values);
+}
+
+} // namespace grib_coder
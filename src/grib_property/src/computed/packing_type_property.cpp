@@ -19,7 +19,7 @@ const std::vector<
     {
         "grid_simple",
         {
-            {"dataRepresentationTemplateNumber", 1},
+            {"dataRepresentationTemplateNumber", 0},
         }
     },
     {
@@ -36,7 +36,9 @@ const std::vector<
     },
 };
 
-bool PackingTypeProperty::decode(GribMessageHandler* handler) {
+bool PackingTypeProperty::compute(GribMessageHandler* handler) {
+    packing_type_ = "MISSING";
+
     std::map<std::string, long> property_map;
 
     property_map["dataRepresentationTemplateNumber"] = handler->getLong("dataRepresentationTemplateNumber");
@@ -58,7 +60,6 @@ bool PackingTypeProperty::decode(GribMessageHandler* handler) {
             break;
         }
     }
-    ComputedProperty::decode(handler);
     return true;
 }
 
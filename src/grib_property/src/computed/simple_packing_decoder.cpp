@@ -0,0 +1,246 @@
+#include "grib_property/computed/simple_packing_decoder.h"
+#include "grib_property/number_convert.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GRIB_PROPERTY_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace grib_coder {
+
+namespace {
+
+// codes are unpacked and scaled in chunks, small enough to stay in cache between the two steps.
+// chunk size is a multiple of 8, so each chunk begins at a byte boundary for all widths.
+const size_t chunk_size = 4096;
+
+// kernels unpack count codes beginning from code first into codes.
+// kernels of common widths without SIMD.
+
+void unpack_codes_8(const uint8_t* data, size_t first, size_t count, int32_t* codes) {
+    data += first;
+    for (size_t i = 0; i < count; i++) {
+        codes[i] = data[i];
+    }
+}
+
+void unpack_codes_16(const uint8_t* data, size_t first, size_t count, int32_t* codes) {
+    data += first * 2;
+    for (size_t i = 0; i < count; i++) {
+        codes[i] = (data[2 * i] << 8) | data[2 * i + 1];
+    }
+}
+
+// two codes in every 3 bytes.
+void unpack_codes_12(const uint8_t* data, size_t first, size_t count, int32_t* codes) {
+    data += first / 2 * 3;
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const auto bytes = data + i / 2 * 3;
+        codes[i] = (bytes[0] << 4) | (bytes[1] >> 4);
+        codes[i + 1] = ((bytes[1] & 0x0f) << 8) | bytes[2];
+    }
+    if (i < count) {
+        const auto bytes = data + i / 2 * 3;
+        codes[i] = (bytes[0] << 4) | (bytes[1] >> 4);
+    }
+}
+
+void unpack_codes_24(const uint8_t* data, size_t first, size_t count, int32_t* codes) {
+    data += first * 3;
+    for (size_t i = 0; i < count; i++) {
+        codes[i] = (data[3 * i] << 16) | (data[3 * i + 1] << 8) | data[3 * i + 2];
+    }
+}
+
+// any width up to 31 bits. Each code is cut from 8 bytes beginning at its first byte,
+// which are padded with zero at the end of bytes.
+void unpack_codes_generic(
+    gsl::span<const std::byte> bytes, int bits_per_value, size_t first, size_t count, int32_t* codes) {
+    for (size_t i = 0; i < count; i++) {
+        const auto bit_offset = (first + i) * bits_per_value;
+        const auto byte_offset = bit_offset / 8;
+
+        uint64_t window;
+        if (byte_offset + 8 <= bytes.size()) {
+            window = convert_bytes_to_number<uint64_t>(bytes.data() + byte_offset);
+        } else {
+            std::array<std::byte, 8> padded{};
+            std::copy(bytes.begin() + byte_offset, bytes.end(), padded.begin());
+            window = convert_bytes_to_number<uint64_t>(padded.data());
+        }
+        codes[i] = static_cast<int32_t>((window << (bit_offset % 8)) >> (64 - bits_per_value));
+    }
+}
+
+#ifdef GRIB_PROPERTY_X86_KERNELS
+
+bool has_avx2() {
+    static const auto result = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return result;
+}
+
+__attribute__((target("avx2")))
+size_t unpack_codes_8_avx2(const uint8_t* data, size_t first, size_t count, int32_t* codes) {
+    data += first;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(codes + i), _mm256_cvtepu8_epi32(bytes));
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+size_t unpack_codes_16_avx2(const uint8_t* data, size_t first, size_t count, int32_t* codes) {
+    data += first * 2;
+    const auto swap_bytes = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 2 * i));
+        _mm256_storeu_si256(
+            reinterpret_cast<__m256i*>(codes + i), _mm256_cvtepu16_epi32(_mm_shuffle_epi8(bytes, swap_bytes)));
+    }
+    return i;
+}
+
+// widths up to 25 bits, 8 codes in each step. 8 codes take bits_per_value bytes, so the position of each code
+// in 32 bytes loaded from the beginning of a step is the same for all steps. Each 128-bit lane holds 4 codes,
+// whose bytes are gathered into 32-bit words by a shuffle, and then shifted to get codes.
+__attribute__((target("avx2")))
+size_t unpack_codes_bits_avx2(gsl::span<const std::byte> bytes, int bits_per_value, size_t first, size_t count, int32_t* codes) {
+    const auto lane_offset = static_cast<size_t>(4 * bits_per_value / 8);
+
+    alignas(32) std::array<int8_t, 32> shuffle_indexes{};
+    alignas(32) std::array<int32_t, 8> shift_counts{};
+    for (auto i = 0; i < 8; i++) {
+        const auto lane = i / 4;
+        const auto bit_offset = i * bits_per_value - static_cast<int>(lane * lane_offset * 8);
+        const auto byte_offset = bit_offset / 8;
+        // the first byte goes to the most significant byte of word.
+        for (auto j = 0; j < 4; j++) {
+            shuffle_indexes[i * 4 + j] = static_cast<int8_t>(byte_offset + 3 - j);
+        }
+        shift_counts[i] = bit_offset % 8;
+    }
+    const auto shuffle_vector = _mm256_load_si256(reinterpret_cast<const __m256i*>(shuffle_indexes.data()));
+    const auto shift_vector = _mm256_load_si256(reinterpret_cast<const __m256i*>(shift_counts.data()));
+    const auto right_shift = _mm_cvtsi32_si128(32 - bits_per_value);
+
+    const auto data = reinterpret_cast<const uint8_t*>(bytes.data());
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const auto byte_offset = (first + i) / 8 * bits_per_value;
+        if (byte_offset + lane_offset + 16 > bytes.size()) {
+            break;
+        }
+        const auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + byte_offset));
+        const auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + byte_offset + lane_offset));
+        auto words = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), shuffle_vector);
+        words = _mm256_srl_epi32(_mm256_sllv_epi32(words, shift_vector), right_shift);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(codes + i), words);
+    }
+    return i;
+}
+
+// return count of unpacked codes in steps of 8 codes, the rest is left to unpack_codes_generic.
+size_t unpack_codes_avx2(gsl::span<const std::byte> bytes, int bits_per_value, size_t first, size_t count, int32_t* codes) {
+    const auto data = reinterpret_cast<const uint8_t*>(bytes.data());
+    switch (bits_per_value) {
+        case 8:
+            return unpack_codes_8_avx2(data, first, count, codes);
+        case 16:
+            return unpack_codes_16_avx2(data, first, count, codes);
+        default:
+            break;
+    }
+    if (bits_per_value <= 25) {
+        return unpack_codes_bits_avx2(bytes, bits_per_value, first, count, codes);
+    }
+    return 0;
+}
+
+#endif
+
+void unpack_codes(gsl::span<const std::byte> bytes, int bits_per_value, size_t first, size_t count, int32_t* codes) {
+    size_t unpacked_count = 0;
+#ifdef GRIB_PROPERTY_X86_KERNELS
+    if (has_avx2()) {
+        unpacked_count = unpack_codes_avx2(bytes, bits_per_value, first, count, codes);
+    }
+#endif
+    if (unpacked_count == 0) {
+        const auto data = reinterpret_cast<const uint8_t*>(bytes.data());
+        switch (bits_per_value) {
+            case 8:
+                return unpack_codes_8(data, first, count, codes);
+            case 12:
+                return unpack_codes_12(data, first, count, codes);
+            case 16:
+                return unpack_codes_16(data, first, count, codes);
+            case 24:
+                return unpack_codes_24(data, first, count, codes);
+            default:
+                break;
+        }
+    }
+    unpack_codes_generic(bytes, bits_per_value, first + unpacked_count, count - unpacked_count, codes + unpacked_count);
+}
+
+// values of double or float, scaled by the kernel of the same type.
+template <typename T>
+bool decode_values(gsl::span<const std::byte> bytes, int bits_per_value, const PackingScale& scale, gsl::span<T> values) {
+    if (bits_per_value < 0 || bits_per_value > 32) {
+        return false;
+    }
+
+    // all codes are 0 in a constant field, which may have no bytes at all.
+    if (bits_per_value == 0) {
+        const auto value = static_cast<T>(scale.reference_value / scale.decimal_scale);
+        std::fill(values.begin(), values.end(), value);
+        return true;
+    }
+    const auto count = values.size();
+    if ((count * bits_per_value + 7) / 8 > bytes.size()) {
+        return false;
+    }
+
+    // codes of 32 bits don't fit in int32 codes of scaling kernel.
+    if (bits_per_value == 32) {
+        for (size_t i = 0; i < count; i++) {
+            const auto code = static_cast<double>(convert_bytes_to_number<uint32_t>(bytes.data() + 4 * i));
+            values[i] = static_cast<T>((scale.reference_value + code * scale.binary_scale) / scale.decimal_scale);
+        }
+        return true;
+    }
+
+    const auto mask = (uint32_t{1} << bits_per_value) - 1;
+    std::array<int32_t, chunk_size> codes;
+    for (size_t first = 0; first < count; first += chunk_size) {
+        const auto chunk_count = std::min(chunk_size, count - first);
+        unpack_codes(bytes, bits_per_value, first, chunk_count, codes.data());
+        scale_packed_codes(codes.data(), mask, scale, values.subspan(first, chunk_count));
+    }
+    return true;
+}
+
+} // namespace
+
+bool decode_simple_packing_values(gsl::span<const std::byte> bytes, int bits_per_value,
+                                  const PackingScale& scale, gsl::span<double> values) {
+    return decode_values(bytes, bits_per_value, scale, values);
+}
+
+bool decode_simple_packing_values(gsl::span<const std::byte> bytes, int bits_per_value,
+                                  const PackingScale& scale, gsl::span<float> values) {
+    return decode_values(bytes, bits_per_value, scale, values);
+}
+
+} // namespace grib_coder
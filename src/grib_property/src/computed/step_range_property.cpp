@@ -7,6 +7,7 @@
 namespace grib_coder {
 
 std::string StepRangeProperty::getString() {
+    computeIfNeeded();
     if (start_ == end_) {
         return fmt::format("{}", start_);
     }
@@ -15,7 +16,7 @@ std::string StepRangeProperty::getString() {
     }
 }
 
-bool StepRangeProperty::decode(GribMessageHandler* handler) {
+bool StepRangeProperty::compute(GribMessageHandler* handler) {
     const auto time_unit = handler->getLong("indicatorOfUnitOfTimeRange");
     const auto forecast_time = handler->getLong("forecastTime");
     start_ = end_ = forecast_time;
@@ -41,7 +42,6 @@ bool StepRangeProperty::decode(GribMessageHandler* handler) {
         return false;
     }
     end_ = length_of_time_range;
-    ComputedProperty::decode(handler);
     return true;
 }
 
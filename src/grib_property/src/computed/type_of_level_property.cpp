@@ -97,10 +97,13 @@ const std::vector<
 
 
 std::string TypeOfLevelProperty::getString() {
+    computeIfNeeded();
     return type_of_level_;
 }
 
-bool TypeOfLevelProperty::decode(GribMessageHandler* handler) {
+bool TypeOfLevelProperty::compute(GribMessageHandler* handler) {
+    type_of_level_ = "MISSING";
+
     std::map<std::string, long> property_map;
 
     property_map["typeOfFirstFixedSurface"] = handler->getLong("typeOfFirstFixedSurface");
@@ -123,7 +126,6 @@ bool TypeOfLevelProperty::decode(GribMessageHandler* handler) {
             break;
         }
     }
-    ComputedProperty::decode(handler);
     return true;
 }
 
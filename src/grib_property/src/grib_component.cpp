@@ -3,7 +3,7 @@
 
 namespace grib_coder {
 
-bool GribComponent::parse(std::vector<std::byte>::const_iterator& iterator) {
+bool GribComponent::parse(const std::byte*& iterator) {
     return true;
 }
 
@@ -37,7 +37,7 @@ std::vector<double> GribProperty::getDoubleArray() {
     throw std::runtime_error("getDoubleArray: not implemented");
 }
 
-bool GribProperty::parse(std::vector<std::byte>::const_iterator& iterator, size_t count) {
+bool GribProperty::parse(const std::byte*& iterator, size_t count) {
     return true;
 }
 
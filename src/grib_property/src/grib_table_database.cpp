@@ -30,6 +30,7 @@ GribTableDatabase::GribTableDatabase() {
 
 std::shared_ptr<GribTable> GribTableDatabase::getGribTable(const std::string& table_version, const std::string& name) {
     const auto table_name = table_version + "." + name;
+    std::lock_guard<std::mutex> lock{mutex_};
     if (tables_.find(table_name) != tables_.end()) {
         return tables_[table_name];
     }
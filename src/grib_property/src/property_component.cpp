@@ -20,11 +20,11 @@ GribProperty* PropertyComponent::getProperty() {
     return property_;
 }
 
-std::string PropertyComponent::getPropertyName() const {
+const std::string& PropertyComponent::getPropertyName() const {
     return property_name_;
 }
 
-bool PropertyComponent::parse(std::vector<std::byte>::const_iterator& iterator) {
+bool PropertyComponent::parse(const std::byte*& iterator) {
     property_->parse(iterator, byte_count_);
     iterator += byte_count_;
     return true;
@@ -11,7 +11,7 @@ std::string StringProperty::getString() {
     return value_;
 }
 
-bool StringProperty::parse(std::vector<std::byte>::const_iterator& iterator, size_t count) {
+bool StringProperty::parse(const std::byte*& iterator, size_t count) {
     value_ = std::string(reinterpret_cast<const char*>(&(*iterator)), count);
     return true;
 }
@@ -0,0 +1,39 @@
+#include "codes_copy.h"
+
+#include <grib_coder/grib_message_copier.h>
+#include <fmt/format.h>
+
+#include <exception>
+#include <tuple>
+
+namespace grib_tool {
+
+int copy_grib_file(
+    const std::string& file_path,
+    const std::string& output_file_path,
+    const std::vector<Condition>& conditions) {
+    fmt::print("{file_path}\n", fmt::arg("file_path", file_path));
+
+    std::vector<std::tuple<std::string, std::string>> copy_conditions;
+    for (const auto& condition : conditions) {
+        copy_conditions.emplace_back(condition.property_name, condition.value);
+    }
+
+    // files can't be opened or copied, or target is the same file as source.
+    try {
+        grib_coder::GribMessageCopier copier(file_path, output_file_path);
+        const auto message_copied = copier.copyMatchingMessages(copy_conditions);
+
+        fmt::print("{message_copied} grib2 messages ({length} bytes) copied into {output_file_path}\n",
+                   fmt::arg("message_copied", message_copied),
+                   fmt::arg("length", copier.getCopiedLength()),
+                   fmt::arg("output_file_path", output_file_path));
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace grib_tool
@@ -0,0 +1,9 @@
+#pragma once
+#include "../tool_util/condition.h"
+
+namespace grib_tool {
+int copy_grib_file(
+    const std::string& file_path,
+    const std::string& output_file_path,
+    const std::vector<Condition>& conditions);
+} // namespace grib_tool
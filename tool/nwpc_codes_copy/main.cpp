@@ -0,0 +1,30 @@
+#include "codes_copy.h"
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+
+
+int main(int argc, char** argv) {
+    CLI::App app{"nwpc_codes_copy"};
+
+    std::string file_path;
+    app.add_option("file_path", file_path, "grib file path")
+       ->check(CLI::ExistingFile);
+    std::string output_file_path;
+    app.add_option("output_file_path", output_file_path, "output grib file path");
+    std::string conditions_option;
+    app.add_option("-w", conditions_option, "filter condition");
+
+    CLI11_PARSE(app, argc, argv);
+
+    if (file_path.empty() || output_file_path.empty()) {
+        fmt::print("{}\n", app.help());
+        return 0;
+    }
+
+    const auto conditions = grib_tool::parse_conditions(conditions_option);
+
+    const auto result = grib_tool::copy_grib_file(file_path, output_file_path, conditions);
+
+    return result;
+}
@@ -1,32 +1,51 @@
 #include "codes_dump.h"
 
-#include <grib_coder/grib_file_handler.h>
+#include <grib_coder/grib_pipeline_file_handler.h>
 #include <fmt/format.h>
 
+#include <cstdio>
+#include <exception>
+
 namespace grib_tool {
 
 int dump_grib_file(const std::string& file_path, const std::vector<Condition>& conditions) {
     fmt::print("{file_path}\n", fmt::arg("file_path", file_path));
     auto f = std::fopen(file_path.c_str(), "rb");
+    if (f == nullptr) {
+        fmt::print(stderr, "can't open file: {}\n", file_path);
+        return 1;
+    }
 
     //auto start_time = std::chrono::system_clock::now();
 
-    grib_coder::GribFileHandler handler(f, false);
     auto current_index = 0;
     auto message_selected = 0;
-    auto message_handler = handler.next();
-
-    while (message_handler) {
-        current_index++;
-        if (!check_conditions(message_handler, conditions)) {
+    auto result = true;
+
+    try {
+        // read and decode next messages while dumping current one.
+        // values are decoded only for messages matching conditions,
+        // and messages are selected again here in file order.
+        const auto is_selected = [&conditions](grib_coder::GribMessageHandler* message_handler) {
+            return check_conditions(message_handler, conditions);
+        };
+        grib_coder::GribPipelineFileHandler handler(f, 8, is_selected);
+        auto message_handler = handler.next();
+
+        while (message_handler) {
+            current_index++;
+            if (!is_selected(message_handler.get())) {
+                message_handler = handler.next();
+                continue;
+            }
+
+            message_selected++;
+            message_handler->dump();
             message_handler = handler.next();
-            continue;
         }
-
-        message_selected++;
-        message_handler->decodeValues();
-        message_handler->dump();
-        message_handler = handler.next();
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        result = false;
     }
 
     std::fclose(f);
@@ -36,7 +55,7 @@ int dump_grib_file(const std::string& file_path, const std::vector<Condition>& c
                fmt::arg("count", current_index),
                fmt::arg("file_path", file_path));
 
-    return 0;
+    return result ? 0 : 1;
 }
 
 
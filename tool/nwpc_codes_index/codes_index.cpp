@@ -0,0 +1,29 @@
+#include "codes_index.h"
+
+#include <grib_coder/grib_index.h>
+#include <fmt/format.h>
+
+namespace grib_tool {
+
+int build_index(const std::string& file_path, const std::string& index_file_path) {
+    fmt::print("{file_path}\n", fmt::arg("file_path", file_path));
+
+    grib_coder::GribIndex index;
+    if (!index.buildFromFile(file_path)) {
+        fmt::print(stderr, "can't open file: {}\n", file_path);
+        return 1;
+    }
+
+    if (!index.writeFile(index_file_path)) {
+        fmt::print(stderr, "can't write index file: {}\n", index_file_path);
+        return 1;
+    }
+
+    fmt::print("{count} grib2 messages indexed in {index_file_path}\n",
+               fmt::arg("count", index.records().size()),
+               fmt::arg("index_file_path", index_file_path));
+
+    return 0;
+}
+
+} // namespace grib_tool
@@ -0,0 +1,6 @@
+#pragma once
+#include <string>
+
+namespace grib_tool {
+int build_index(const std::string& file_path, const std::string& index_file_path);
+} // namespace grib_tool
@@ -0,0 +1,30 @@
+#include "codes_index.h"
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+
+
+int main(int argc, char** argv) {
+    CLI::App app{"nwpc_codes_index"};
+
+    std::string file_path;
+    app.add_option("file_path", file_path, "grib file path")
+       ->check(CLI::ExistingFile);
+    std::string index_file_path;
+    app.add_option("-o", index_file_path, "index file path, default is file_path.idx");
+
+    CLI11_PARSE(app, argc, argv);
+
+    if (file_path.empty()) {
+        fmt::print("{}\n", app.help());
+        return 0;
+    }
+
+    if (index_file_path.empty()) {
+        index_file_path = file_path + ".idx";
+    }
+
+    const auto result = grib_tool::build_index(file_path, index_file_path);
+
+    return result;
+}
@@ -1,13 +1,14 @@
 #include "codes_ls.h"
 
 #include <grib_coder/grib_file_handler.h>
+#include <grib_coder/grib_follow_file_handler.h>
 #include <fmt/printf.h>
 
 namespace grib_tool {
 
-int list_grib_file(const std::string& file_path, const std::vector<Condition>& conditions) {
+int list_grib_file(const std::string& file_path, const std::vector<Condition>& conditions,
+                   bool follow, std::chrono::milliseconds follow_timeout) {
     fmt::print("{file_path}\n", fmt::arg("file_path", file_path));
-    auto f = std::fopen(file_path.c_str(), "rb");
 
     //auto start_time = std::chrono::system_clock::now();
 
@@ -26,42 +27,63 @@ int list_grib_file(const std::string& file_path, const std::vector<Condition>& c
         {"packingType", property_type::String},
     };
 
-    grib_coder::GribFileHandler handler(f, true);
+    // resolve keys once, instead of looking up names for every message.
+    std::vector<grib_coder::KeyId> property_keys;
+    for (const auto& property_item : property_list) {
+        property_keys.emplace_back(property_item.name);
+    }
+
     auto current_index = 0;
     auto message_selected = 0;
-    auto message_handler = handler.next();
 
-    while (message_handler) {
+    auto print_message = [&](grib_coder::GribMessageHandler* message_handler) {
         current_index++;
         if (!check_conditions(message_handler, conditions)) {
-            message_handler = handler.next();
-            continue;
+            return;
         }
 
         message_selected++;
         std::vector<std::string> tokens;
-        for (const auto& property_item : property_list) {
-            const auto property_type = property_item.type;
-            const auto property_name = property_item.name;
+        for (size_t i = 0; i < property_list.size(); i++) {
+            const auto property_type = property_list[i].type;
+            const auto property_key = property_keys[i];
             switch (property_type) {
             case property_type::Long:
-                tokens.emplace_back(fmt::format("{}", message_handler->getLong(property_name)));
+                tokens.emplace_back(fmt::format("{}", message_handler->getLong(property_key)));
                 break;
             case property_type::Double:
-                tokens.emplace_back(fmt::format("{}", message_handler->getDouble(property_name)));
+                tokens.emplace_back(fmt::format("{}", message_handler->getDouble(property_key)));
                 break;
             case property_type::String:
             default:
-                tokens.emplace_back(fmt::format("{}", message_handler->getString(property_name)));
+                tokens.emplace_back(fmt::format("{}", message_handler->getString(property_key)));
                 break;
             }
         }
 
         fmt::print("{}\n", fmt::join(tokens, " | "));
-        message_handler = handler.next();
-    }
+    };
 
-    std::fclose(f);
+    if (follow) {
+        // print each message as soon as it is written, so flush output for downstream tools.
+        grib_coder::GribFollowFileHandler handler(file_path, true, follow_timeout);
+        auto message_handler = handler.next();
+        while (message_handler) {
+            print_message(message_handler.get());
+            std::fflush(stdout);
+            message_handler = handler.next(std::move(message_handler));
+        }
+    } else {
+        auto f = std::fopen(file_path.c_str(), "rb");
+        grib_coder::GribFileHandler handler(f, true);
+        handler.setAccessPattern(grib_coder::GribAccessPattern::Sequential);
+        auto message_handler = handler.next();
+        while (message_handler) {
+            print_message(message_handler.get());
+            message_handler = handler.next(std::move(message_handler));
+        }
+        std::fclose(f);
+    }
 
     fmt::print("{message_selected} of {count} grib2 messages in {file_path}\n",
                fmt::arg("message_selected", message_selected),
@@ -1,6 +1,11 @@
 #pragma once
 #include "../tool_util/condition.h"
 
+#include <chrono>
+
 namespace grib_tool {
-int list_grib_file(const std::string& file_path, const std::vector<Condition>& conditions);
+// if follow is set, wait for new messages appended to file until no message arrives in follow_timeout,
+// zero means waiting forever.
+int list_grib_file(const std::string& file_path, const std::vector<Condition>& conditions,
+                   bool follow = false, std::chrono::milliseconds follow_timeout = std::chrono::milliseconds{0});
 } // namespace grib_tool
@@ -12,6 +12,11 @@ int main(int argc, char** argv) {
        ->check(CLI::ExistingFile);
     std::string conditions_option;
     app.add_option("-w", conditions_option, "filter condition");
+    bool follow = false;
+    app.add_flag("-f,--follow", follow, "wait for messages appended to file");
+    double follow_timeout = 0;
+    app.add_option("--follow-timeout", follow_timeout,
+                   "seconds to wait for the next message in follow mode, 0 means waiting forever");
 
     CLI11_PARSE(app, argc, argv);
 
@@ -22,7 +27,9 @@ int main(int argc, char** argv) {
 
     const auto conditions = grib_tool::parse_conditions(conditions_option);
 
-    const auto result = grib_tool::list_grib_file(file_path, conditions);
+    const auto result = grib_tool::list_grib_file(
+        file_path, conditions, follow,
+        std::chrono::milliseconds{static_cast<long long>(follow_timeout * 1000)});
 
     return result;
 }
@@ -0,0 +1,226 @@
+#include "codes_split.h"
+
+#include <grib_coder/grib_file_handler.h>
+#include <grib_coder/grib_mapped_file.h>
+#include <fmt/format.h>
+
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace grib_tool {
+
+namespace {
+
+// stdio buffer size of each output file.
+const size_t output_buffer_length = 1 << 20;
+
+// buffered output files, at most max_open_files of which are open at the same time.
+// the least recently used file is closed when another one needs to be opened,
+// and it is opened again in append mode when more messages are written into it.
+//
+// buffered bytes may fail to be written when a file is closed, such as on a full disk, so errors of
+// fwrite and fclose are both reported with file path.
+class OutputFilePool {
+public:
+    explicit OutputFilePool(size_t max_open_files):
+        max_open_files_{max_open_files == 0 ? 1 : max_open_files} {
+    }
+
+    // files not closed by closeAll() are closed without checking, after an error has been reported.
+    ~OutputFilePool() {
+        for (auto& item : open_files_) {
+            std::fclose(item.second.file);
+        }
+    }
+
+    OutputFilePool(const OutputFilePool&) = delete;
+    OutputFilePool& operator= (const OutputFilePool&) = delete;
+
+    bool write(const std::string& file_path, gsl::span<const std::byte> bytes) {
+        auto file = getFile(file_path);
+        if (file == nullptr) {
+            return false;
+        }
+        if (std::fwrite(bytes.data(), 1, bytes.size(), file) != bytes.size()) {
+            fmt::print(stderr, "can't write file: {}\n", file_path);
+            return false;
+        }
+        return true;
+    }
+
+    // close all open files, return false if any of them fails.
+    bool closeAll() {
+        auto result = true;
+        for (auto& item : open_files_) {
+            result = closeFile(item.first, item.second.file) && result;
+        }
+        open_files_.clear();
+        return result;
+    }
+
+    size_t getFileCount() const {
+        return created_files_.size();
+    }
+
+private:
+    struct OutputFile {
+        std::FILE* file = nullptr;
+        uint64_t last_used = 0;
+    };
+
+    // return nullptr if file can't be opened, or another file can't be closed to make room for it.
+    std::FILE* getFile(const std::string& file_path) {
+        use_count_++;
+        auto iter = open_files_.find(file_path);
+        if (iter != std::end(open_files_)) {
+            iter->second.last_used = use_count_;
+            return iter->second.file;
+        }
+
+        if (open_files_.size() >= max_open_files_ && !closeLeastRecentlyUsedFile()) {
+            return nullptr;
+        }
+
+        // truncate file when it is first written in this run.
+        const auto created = created_files_.find(file_path) != std::end(created_files_);
+        if (!created) {
+            const auto parent_path = std::filesystem::path{file_path}.parent_path();
+            if (!parent_path.empty()) {
+                std::filesystem::create_directories(parent_path);
+            }
+        }
+
+        auto file = std::fopen(file_path.c_str(), created ? "ab" : "wb");
+        if (file == nullptr) {
+            fmt::print(stderr, "can't open file: {}\n", file_path);
+            return nullptr;
+        }
+        std::setvbuf(file, nullptr, _IOFBF, output_buffer_length);
+
+        created_files_.insert(file_path);
+        open_files_[file_path] = OutputFile{file, use_count_};
+        return file;
+    }
+
+    bool closeLeastRecentlyUsedFile() {
+        auto least_used = std::begin(open_files_);
+        for (auto iter = std::begin(open_files_); iter != std::end(open_files_); ++iter) {
+            if (iter->second.last_used < least_used->second.last_used) {
+                least_used = iter;
+            }
+        }
+        const auto result = closeFile(least_used->first, least_used->second.file);
+        open_files_.erase(least_used);
+        return result;
+    }
+
+    // fclose writes buffered bytes, so it fails if they can't be written.
+    static bool closeFile(const std::string& file_path, std::FILE* file) {
+        if (std::fclose(file) != 0) {
+            fmt::print(stderr, "can't write file: {}\n", file_path);
+            return false;
+        }
+        return true;
+    }
+
+    size_t max_open_files_ = 64;
+    uint64_t use_count_ = 0;
+    std::unordered_map<std::string, OutputFile> open_files_;
+    std::unordered_set<std::string> created_files_;
+};
+
+// replace {key} in output template with string value of key.
+std::string format_output_path(
+    const std::string& output_template,
+    std::unique_ptr<grib_coder::GribMessageHandler>& message_handler) {
+    std::string output_path;
+    size_t pos = 0;
+    while (pos < output_template.size()) {
+        const auto begin_pos = output_template.find('{', pos);
+        if (begin_pos == std::string::npos) {
+            break;
+        }
+        const auto end_pos = output_template.find('}', begin_pos);
+        if (end_pos == std::string::npos) {
+            throw std::runtime_error(fmt::format("output template is not valid: {}", output_template));
+        }
+        output_path.append(output_template, pos, begin_pos - pos);
+        const auto key = output_template.substr(begin_pos + 1, end_pos - begin_pos - 1);
+        try {
+            output_path.append(message_handler->getString(key));
+        } catch (const std::exception& e) {
+            throw std::runtime_error(fmt::format("can't get key {} in output template: {}", key, e.what()));
+        }
+        pos = end_pos + 1;
+    }
+    if (pos < output_template.size()) {
+        output_path.append(output_template, pos, std::string::npos);
+    }
+    return output_path;
+}
+
+} // namespace
+
+int split_grib_file(
+    const std::string& file_path,
+    const std::string& output_template,
+    const std::vector<Condition>& conditions,
+    size_t max_open_files) {
+    fmt::print("{file_path}\n", fmt::arg("file_path", file_path));
+
+    // messages are read from mapping in file order, so file is read only once.
+    std::shared_ptr<grib_coder::GribMappedFile> mapped_file;
+    try {
+        mapped_file = std::make_shared<grib_coder::GribMappedFile>(file_path);
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        return 1;
+    }
+    grib_coder::GribFileHandler handler(mapped_file, true);
+    handler.setAccessPattern(grib_coder::GribAccessPattern::Sequential);
+    // handler keeps default readahead in header only mode, but whole messages are copied from mapping.
+    mapped_file->setAccessPattern(grib_coder::GribAccessPattern::Sequential);
+    OutputFilePool file_pool{max_open_files};
+
+    auto current_index = 0;
+    auto message_selected = 0;
+    auto result = true;
+    // keys of output template may not be found, and directories may not be created.
+    try {
+        auto message_handler = handler.next();
+        while (message_handler) {
+            current_index++;
+            if (!check_conditions(message_handler, conditions)) {
+                message_handler = handler.next(std::move(message_handler));
+                continue;
+            }
+
+            message_selected++;
+            const auto output_path = format_output_path(output_template, message_handler);
+            result = file_pool.write(output_path, mapped_file->bytes(
+                message_handler->getLong("offset"), message_handler->getLong("totalLength")));
+            if (!result) {
+                break;
+            }
+            message_handler = handler.next(std::move(message_handler));
+        }
+    } catch (const std::exception& e) {
+        fmt::print(stderr, "{}\n", e.what());
+        result = false;
+    }
+    result = file_pool.closeAll() && result;
+
+    fmt::print("{message_selected} of {count} grib2 messages in {file_path} split into {file_count} files\n",
+               fmt::arg("message_selected", message_selected),
+               fmt::arg("count", current_index),
+               fmt::arg("file_path", file_path),
+               fmt::arg("file_count", file_pool.getFileCount()));
+
+    return result ? 0 : 1;
+}
+
+} // namespace grib_tool
@@ -0,0 +1,10 @@
+#pragma once
+#include "../tool_util/condition.h"
+
+namespace grib_tool {
+int split_grib_file(
+    const std::string& file_path,
+    const std::string& output_template,
+    const std::vector<Condition>& conditions,
+    size_t max_open_files);
+} // namespace grib_tool
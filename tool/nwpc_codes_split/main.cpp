@@ -0,0 +1,33 @@
+#include "codes_split.h"
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+
+
+int main(int argc, char** argv) {
+    CLI::App app{"nwpc_codes_split"};
+
+    std::string file_path;
+    app.add_option("file_path", file_path, "grib file path")
+       ->check(CLI::ExistingFile);
+    std::string output_template;
+    app.add_option("output_template", output_template,
+                   "output file path with keys, such as {parameterNumber}_{typeOfLevel}_{level}.grb2");
+    std::string conditions_option;
+    app.add_option("-w", conditions_option, "filter condition");
+    size_t max_open_files = 64;
+    app.add_option("--max-open-files", max_open_files, "max count of output files opened at the same time");
+
+    CLI11_PARSE(app, argc, argv);
+
+    if (file_path.empty() || output_template.empty()) {
+        fmt::print("{}\n", app.help());
+        return 0;
+    }
+
+    const auto conditions = grib_tool::parse_conditions(conditions_option);
+
+    const auto result = grib_tool::split_grib_file(file_path, output_template, conditions, max_open_files);
+
+    return result;
+}
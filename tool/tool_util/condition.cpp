@@ -1,5 +1,6 @@
 #include "condition.h"
 #include <grib_coder/grib_message_handler.h>
+#include <grib_coder/grib_index.h>
 
 #include <stdexcept>
 
@@ -14,6 +15,7 @@ Condition parse_condition(const std::string& condition) {
     const auto value = condition.substr(pos + 1);
     Condition c;
     c.property_name = name;
+    c.property_key = grib_coder::KeyId{name};
     c.value = value;
     return c;
 }
@@ -40,12 +42,18 @@ std::vector<Condition> parse_conditions(const std::string& condition) {
 bool check_conditions(
     std::unique_ptr<grib_coder::GribMessageHandler>& message_handler,
     const std::vector<Condition>& conditions) {
+    return check_conditions(message_handler.get(), conditions);
+}
+
+bool check_conditions(
+    grib_coder::GribMessageHandler* message_handler,
+    const std::vector<Condition>& conditions) {
+    // code table keys are compared with code numbers, in the same way as match_conditions in index.
     for (const auto& condition : conditions) {
-        auto name = condition.property_name;
-        auto value = condition.value;
-        auto value_type = condition.value_type;
-        auto message_value = message_handler->getString(name);
-        if (value != message_value) {
+        const auto value = grib_coder::is_code_number_key(condition.property_name)
+            ? std::to_string(message_handler->getLong(condition.property_key))
+            : message_handler->getString(condition.property_key);
+        if (condition.value != value) {
             return false;
         }
     }
@@ -1,4 +1,6 @@
 #pragma once
+#include <grib_coder/grib_key.h>
+
 #include <string>
 #include <vector>
 #include <memory>
@@ -23,6 +25,7 @@ struct PropertyItem {
 
 struct Condition {
     std::string property_name;
+    grib_coder::KeyId property_key;
     property_type value_type = property_type::String;
     std::string value;
 };
@@ -32,4 +35,8 @@ std::vector<Condition> parse_conditions(const std::string& condition);
 bool check_conditions(
     std::unique_ptr<grib_coder::GribMessageHandler>& message_handler,
     const std::vector<Condition>& conditions);
+
+bool check_conditions(
+    grib_coder::GribMessageHandler* message_handler,
+    const std::vector<Condition>& conditions);
 } // namespace grib_tool